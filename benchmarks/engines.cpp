@@ -0,0 +1,74 @@
+#include "harness.hpp"
+
+#include <ecfcpp/ecfcpp.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace
+{
+
+// Generations every iteration runs. Fitness never reaches the desired one, so
+// every run lasts exactly that long.
+constexpr std::size_t generations   { 10  };
+constexpr double      desiredFitness{ 1   };
+constexpr double      precision     { 0   };
+constexpr float       mortalityRate { 0.1 };
+
+template< std::size_t D, std::size_t N >
+void algorithms( benchmark::Suite & suite )
+{
+    using Chromosome = ecfcpp::Array< double, D >;
+
+    auto const suffix{ "/d=" + std::to_string( D ) + "/n=" + std::to_string( N ) };
+
+    ecfcpp::random::seed( 6 );
+    auto const population{ ecfcpp::factory::create( Chromosome{ -5, 5 }, N, [](){ return ecfcpp::random::uniform( -5.0, 5.0 ); } ) };
+
+    auto const problem  { ecfcpp::problem::Minimization{ ecfcpp::function::rastrigin< Chromosome > } };
+    auto const selection{ ecfcpp::selection::Tournament{ 3 } };
+    auto const crossover{ ecfcpp::crossover::BlxAlpha{ 0.2f } };
+    auto const mutation { ecfcpp::mutation::Gaussian{ 0.01f, true, 0.1f } };
+
+    suite.run
+    (
+        "ga/generational" + suffix,
+        generations,
+        [ & ]
+        {
+            benchmark::keep
+            (
+                ecfcpp::ga::generational( true, generations, desiredFitness, precision, problem, selection, crossover, mutation, population )
+            );
+        }
+    );
+
+    suite.run
+    (
+        "ga/steady_state" + suffix,
+        generations,
+        [ & ]
+        {
+            benchmark::keep
+            (
+                ecfcpp::ga::steady_state( mortalityRate, generations, desiredFitness, precision, problem, selection, crossover, mutation, population )
+            );
+        }
+    );
+}
+
+}
+
+namespace benchmark
+{
+
+// Whole runs of genetic algorithms, counted in generations.
+void engines( Suite & suite )
+{
+    algorithms< 10,  50  >( suite );
+    algorithms< 10,  500 >( suite );
+    algorithms< 100, 50  >( suite );
+    algorithms< 100, 500 >( suite );
+}
+
+}
@@ -0,0 +1,44 @@
+#include "harness.hpp"
+
+#include <ecfcpp/ecfcpp.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace
+{
+
+template< std::size_t D, std::size_t N >
+void create( benchmark::Suite & suite )
+{
+    using Chromosome = ecfcpp::Array< double, D >;
+
+    ecfcpp::random::seed( 5 );
+
+    suite.run
+    (
+        "factory/create/d=" + std::to_string( D ) + "/n=" + std::to_string( N ),
+        N,
+        []
+        {
+            benchmark::keep( ecfcpp::factory::create( Chromosome{ -5, 5 }, N, [](){ return ecfcpp::random::uniform( -5.0, 5.0 ); } ) );
+        }
+    );
+}
+
+}
+
+namespace benchmark
+{
+
+// Creation of random populations, counted in individuals.
+void factories( Suite & suite )
+{
+    create< 10,   100  >( suite );
+    create< 10,   1000 >( suite );
+    create< 100,  100  >( suite );
+    create< 100,  1000 >( suite );
+    create< 1000, 100  >( suite );
+}
+
+}
@@ -0,0 +1,138 @@
+#include "harness.hpp"
+
+#include <ecfcpp/ecfcpp.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+constexpr std::size_t populationSize{ 100 };
+
+template< std::size_t D >
+void scalar( benchmark::Suite & suite )
+{
+    using Chromosome = ecfcpp::Array< double, D >;
+
+    auto const suffix{ "/d=" + std::to_string( D ) };
+
+    ecfcpp::random::seed( 4 );
+    auto const points{ ecfcpp::factory::create( Chromosome{ -5, 5 }, populationSize, [](){ return ecfcpp::random::uniform( -5.0, 5.0 ); } ) };
+
+    auto const run
+    {
+        [ & ]( std::string const & name, auto const & function )
+        {
+            suite.run
+            (
+                "function/" + name + suffix,
+                populationSize,
+                [ & ]
+                {
+                    for ( auto const & point : points )
+                    {
+                        benchmark::keep( function( point ) );
+                    }
+                }
+            );
+        }
+    };
+
+    namespace function = ecfcpp::function;
+
+    run( "ackley",       function::ackley< Chromosome >()       );
+    run( "ackleyn4",     function::ackleyn4< Chromosome >       );
+    run( "alpinen1",     function::alpinen1< Chromosome >       );
+    run( "alpinen2",     function::alpinen2< Chromosome >       );
+    run( "exponential",  function::exponential< Chromosome >    );
+    run( "griewank",     function::griewank< Chromosome >       );
+    run( "rastrigin",    function::rastrigin< Chromosome >      );
+    run( "rosenbrock",   function::rosenbrock< Chromosome >()   );
+    run( "shafferf6",    function::shafferf6< Chromosome >      );
+    run( "shafferf7",    function::shafferf7< Chromosome >      );
+    run( "sphere",       function::sphere< Chromosome >         );
+    run( "offsetSphere", function::offsetSphere< Chromosome >   );
+}
+
+// Batch functions on a structure of arrays population, once for every
+// instruction set the CPU supports.
+template< std::size_t D >
+void batch( benchmark::Suite & suite )
+{
+    using Chromosome = ecfcpp::Array< double, D >;
+    using Population = ecfcpp::ArrayPopulation< double, D >;
+    using ecfcpp::function::batch::InstructionSet;
+
+    auto const suffix{ "/d=" + std::to_string( D ) };
+
+    ecfcpp::random::seed( 4 );
+    Population const population{ ecfcpp::factory::create( Chromosome{ -5, 5 }, populationSize, [](){ return ecfcpp::random::uniform( -5.0, 5.0 ); } ) };
+
+    std::vector< typename Population::decimal_t > scores( populationSize );
+
+    auto const active{ ecfcpp::function::batch::instructionSet() };
+
+    for ( auto const & [ instructionSet, isa ] : { std::pair{ InstructionSet::Scalar, "scalar" }, std::pair{ InstructionSet::Avx2, "avx2" }, std::pair{ InstructionSet::Avx512, "avx512" } } )
+    {
+        if ( ecfcpp::function::batch::useInstructionSet( instructionSet ) != instructionSet )
+        {
+            continue;
+        }
+
+        auto const run
+        {
+            [ &, isa = isa ]( std::string const & name, auto const & function )
+            {
+                suite.run
+                (
+                    "function/batch/" + name + "/" + isa + suffix,
+                    populationSize,
+                    [ & ]
+                    {
+                        function( population, 0, populationSize, scores.data() );
+                        benchmark::keep( scores );
+                    }
+                );
+            }
+        };
+
+        namespace batch = ecfcpp::function::batch;
+
+        run( "ackley",       batch::ackley()       );
+        run( "ackleyn4",     batch::ackleyn4()     );
+        run( "alpinen1",     batch::alpinen1()     );
+        run( "alpinen2",     batch::alpinen2()     );
+        run( "exponential",  batch::exponential()  );
+        run( "griewank",     batch::griewank()     );
+        run( "rastrigin",    batch::rastrigin()    );
+        run( "rosenbrock",   batch::rosenbrock()   );
+        run( "shafferf6",    batch::shafferf6()    );
+        run( "shafferf7",    batch::shafferf7()    );
+        run( "sphere",       batch::sphere()       );
+        run( "offsetSphere", batch::offsetSphere() );
+    }
+
+    ecfcpp::function::batch::useInstructionSet( active );
+}
+
+}
+
+namespace benchmark
+{
+
+// Every test function, per point and per batch.
+void functions( Suite & suite )
+{
+    scalar< 10   >( suite );
+    scalar< 100  >( suite );
+    scalar< 1000 >( suite );
+
+    batch< 10   >( suite );
+    batch< 100  >( suite );
+    batch< 1000 >( suite );
+}
+
+}
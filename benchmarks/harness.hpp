@@ -0,0 +1,265 @@
+#ifndef ECFCPP_BENCHMARKS_HARNESS_HPP
+#define ECFCPP_BENCHMARKS_HARNESS_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#include <x86intrin.h>
+#define ECFCPP_BENCHMARKS_CYCLES
+#endif
+
+namespace benchmark
+{
+
+// Keeps the compiler from optimizing away computation of value, and from
+// assuming that memory is unchanged afterwards.
+template< typename T >
+inline void keep( T const & value ) noexcept
+{
+    __asm__ __volatile__( "" : : "g"( &value ) : "memory" );
+}
+
+// Cycle counter of the CPU, zero where none is available. On x86 this is the
+// time stamp counter, which counts at a constant rate regardless of frequency
+// scaling.
+inline std::uint64_t cycles() noexcept
+{
+#ifdef ECFCPP_BENCHMARKS_CYCLES
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+constexpr bool hasCycles() noexcept
+{
+#ifdef ECFCPP_BENCHMARKS_CYCLES
+    return true;
+#else
+    return false;
+#endif
+}
+
+struct Options
+{
+    std::string filter;
+    std::size_t warmup        { 2    };
+    std::size_t repetitions   { 15   };
+    double      minSampleTime { 0.01 }; // seconds
+};
+
+// Order statistics of samples, per iteration.
+struct Statistics
+{
+    double min   { 0 };
+    double median{ 0 };
+    double mean  { 0 };
+    double p99   { 0 };
+    double max   { 0 };
+};
+
+struct Result
+{
+    std::string name;
+    std::size_t iterations;
+    std::size_t items;
+    Statistics  nanoseconds;
+    Statistics  cycles;
+};
+
+inline Statistics statistics( std::vector< double > samples )
+{
+    Statistics result;
+    if ( samples.empty() )
+    {
+        return result;
+    }
+
+    std::sort( std::begin( samples ), std::end( samples ) );
+
+    auto const count{ std::size( samples ) };
+    auto const rank
+    {
+        [ & samples, count ]( double const quantile )
+        {
+            auto const index{ static_cast< std::size_t >( std::ceil( quantile * static_cast< double >( count ) ) ) };
+            return samples[ std::clamp( index, std::size_t{ 1 }, count ) - 1 ];
+        }
+    };
+
+    double sum{ 0 };
+    for ( auto const sample : samples )
+    {
+        sum += sample;
+    }
+
+    result.min    = samples.front();
+    result.median = count % 2 == 1 ? samples[ count / 2 ] : ( samples[ count / 2 - 1 ] + samples[ count / 2 ] ) / 2;
+    result.mean   = sum / static_cast< double >( count );
+    result.p99    = rank( 0.99 );
+    result.max    = samples.back();
+    return result;
+}
+
+inline void writeString( std::ostream & stream, std::string const & text )
+{
+    stream << '"';
+    for ( auto const c : text )
+    {
+        if ( c == '"' || c == '\\' )
+        {
+            stream << '\\';
+        }
+        stream << c;
+    }
+    stream << '"';
+}
+
+inline void writeStatistics( std::ostream & stream, Statistics const & statistics )
+{
+    stream << "{ \"min\": "    << statistics.min
+           << ", \"median\": " << statistics.median
+           << ", \"mean\": "   << statistics.mean
+           << ", \"p99\": "    << statistics.p99
+           << ", \"max\": "    << statistics.max
+           << " }";
+}
+
+// Runs benchmarks and collects their results. Every benchmark is a function
+// doing one iteration of work on items items. Each sample times as many
+// iterations as fit into minSampleTime; warmup samples are discarded and the
+// rest summarized per iteration.
+class Suite
+{
+public:
+    Suite( Options options ) : options_{ std::move( options ) } {}
+
+    template< typename Function >
+    void run( std::string const & name, std::size_t const items, Function && function )
+    {
+        if ( name.find( options_.filter ) == std::string::npos )
+        {
+            return;
+        }
+
+        using Clock = std::chrono::steady_clock;
+
+        auto const sample
+        {
+            [ & function ]( std::size_t const iterations )
+            {
+                auto const startCycles{ benchmark::cycles() };
+                auto const start{ Clock::now() };
+                for ( std::size_t i{ 0 }; i < iterations; ++i )
+                {
+                    function();
+                }
+                auto const end{ Clock::now() };
+                auto const endCycles{ benchmark::cycles() };
+
+                return std::pair
+                {
+                    std::chrono::duration< double, std::nano >( end - start ).count(),
+                    static_cast< double >( endCycles - startCycles )
+                };
+            }
+        };
+
+        auto const minSampleTime{ options_.minSampleTime * 1e9 };
+
+        std::size_t iterations{ 1 };
+        for ( auto elapsed{ sample( iterations ).first }; elapsed < minSampleTime; elapsed = sample( iterations ).first )
+        {
+            auto const factor{ elapsed > 0 ? 1.2 * minSampleTime / elapsed : 10.0 };
+            iterations = static_cast< std::size_t >( std::ceil( static_cast< double >( iterations ) * std::clamp( factor, 1.5, 10.0 ) ) );
+        }
+
+        for ( std::size_t i{ 0 }; i < options_.warmup; ++i )
+        {
+            sample( iterations );
+        }
+
+        std::vector< double > nanoseconds;
+        std::vector< double > cycleCounts;
+        for ( std::size_t i{ 0 }; i < options_.repetitions; ++i )
+        {
+            auto const [ elapsed, counted ]{ sample( iterations ) };
+            nanoseconds.push_back( elapsed / static_cast< double >( iterations ) );
+            cycleCounts.push_back( counted / static_cast< double >( iterations ) );
+        }
+
+        results_.push_back( { name, iterations, items, statistics( nanoseconds ), statistics( cycleCounts ) } );
+
+        std::cerr << std::left << std::setw( 56 ) << name << ' ' << results_.back().nanoseconds.median << " ns\n";
+    }
+
+    // Writes results as a JSON object with a context, as key-value pairs of
+    // strings, and one entry per benchmark.
+    void write( std::ostream & stream, std::vector< std::pair< std::string, std::string > > const & context ) const
+    {
+        stream << std::setprecision( 9 );
+
+        stream << "{\n  \"context\": {";
+        char const * separator{ "\n" };
+        for ( auto const & [ key, value ] : context )
+        {
+            stream << separator << "    ";
+            writeString( stream, key );
+            stream << ": ";
+            writeString( stream, value );
+            separator = ",\n";
+        }
+        stream << "\n  },\n  \"benchmarks\": [";
+
+        separator = "\n";
+        for ( auto const & result : results_ )
+        {
+            auto const seconds{ result.nanoseconds.median * 1e-9 };
+
+            stream << separator << "    {\n      \"name\": ";
+            writeString( stream, result.name );
+            stream << ",\n      \"iterations\": " << result.iterations
+                   << ",\n      \"repetitions\": " << options_.repetitions
+                   << ",\n      \"items_per_iteration\": " << result.items
+                   << ",\n      \"items_per_second\": " << ( seconds > 0 ? static_cast< double >( result.items ) / seconds : 0 )
+                   << ",\n      \"ns\": ";
+            writeStatistics( stream, result.nanoseconds );
+            stream << ",\n      \"cycles\": ";
+            if ( hasCycles() )
+            {
+                writeStatistics( stream, result.cycles );
+            }
+            else
+            {
+                stream << "null";
+            }
+            stream << "\n    }";
+            separator = ",\n";
+        }
+        stream << "\n  ]\n}\n";
+    }
+
+private:
+    Options               options_;
+    std::vector< Result > results_;
+};
+
+// Benchmark groups, each in its own translation unit.
+void operators( Suite & suite );
+void functions( Suite & suite );
+void factories( Suite & suite );
+void engines  ( Suite & suite );
+
+}
+
+#endif // ECFCPP_BENCHMARKS_HARNESS_HPP
@@ -0,0 +1,124 @@
+#include "harness.hpp"
+
+#include <ecfcpp/ecfcpp.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+constexpr char const * usage
+{
+    "Usage: ecfcpp_benchmarks [--filter=TEXT] [--warmup=N] [--repetitions=N] [--min-time=SECONDS] [--out=FILE]\n"
+    "Runs benchmarks whose names contain TEXT and writes results as JSON to FILE, or to standard output.\n"
+};
+
+bool parse( std::string const & argument, std::string const & flag, std::string & value )
+{
+    auto const prefix{ flag + '=' };
+    if ( argument.compare( 0, std::size( prefix ), prefix ) != 0 )
+    {
+        return false;
+    }
+    value = argument.substr( std::size( prefix ) );
+    return true;
+}
+
+char const * instructionSetName( ecfcpp::function::batch::InstructionSet const instructionSet ) noexcept
+{
+    switch ( instructionSet )
+    {
+        case ecfcpp::function::batch::InstructionSet::Avx512: return "avx512";
+        case ecfcpp::function::batch::InstructionSet::Avx2  : return "avx2";
+        default                                              : return "scalar";
+    }
+}
+
+}
+
+int main( int const argc, char const * const * const argv )
+{
+    benchmark::Options options;
+    std::string        out;
+
+    for ( int i{ 1 }; i < argc; ++i )
+    {
+        std::string const argument{ argv[ i ] };
+        std::string       value;
+
+        if ( parse( argument, "--filter", value ) )
+        {
+            options.filter = value;
+        }
+        else if ( parse( argument, "--warmup", value ) )
+        {
+            options.warmup = std::stoul( value );
+        }
+        else if ( parse( argument, "--repetitions", value ) && std::stoul( value ) > 0 )
+        {
+            options.repetitions = std::stoul( value );
+        }
+        else if ( parse( argument, "--min-time", value ) )
+        {
+            options.minSampleTime = std::stod( value );
+        }
+        else if ( parse( argument, "--out", value ) )
+        {
+            out = value;
+        }
+        else
+        {
+            std::cerr << usage;
+            return argument == "--help" ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    std::vector< std::pair< std::string, std::string > > const context
+    {
+#if defined( __clang__ )
+        { "compiler", "clang " __clang_version__ },
+#elif defined( __GNUC__ )
+        { "compiler", "gcc " __VERSION__ },
+#else
+        { "compiler", "unknown" },
+#endif
+#ifdef NDEBUG
+        { "assertions", "off" },
+#else
+        { "assertions", "on" },
+#endif
+#ifdef ECFCPP_USE_PCG
+        { "random_engine", "pcg32" },
+#else
+        { "random_engine", "xoshiro256++" },
+#endif
+        { "instruction_set", instructionSetName( ecfcpp::function::batch::instructionSet() ) },
+        { "cycle_counter",   benchmark::hasCycles() ? "rdtsc" : "none"                       },
+        { "warmup",          std::to_string( options.warmup )                                 },
+        { "repetitions",     std::to_string( options.repetitions )                            },
+        { "min_sample_time", std::to_string( options.minSampleTime )                          }
+    };
+
+    benchmark::Suite suite{ options };
+
+    benchmark::operators( suite );
+    benchmark::functions( suite );
+    benchmark::factories( suite );
+    benchmark::engines  ( suite );
+
+    if ( out.empty() )
+    {
+        suite.write( std::cout, context );
+        return EXIT_SUCCESS;
+    }
+
+    std::ofstream file{ out };
+    suite.write( file, context );
+    return file ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,209 @@
+#include "harness.hpp"
+
+#include <ecfcpp/ecfcpp.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+template< std::size_t D >
+void crossovers( benchmark::Suite & suite )
+{
+    using Chromosome = ecfcpp::Array< double, D >;
+    using Binary     = ecfcpp::BinaryArray< double, D >;
+
+    auto const suffix{ "/d=" + std::to_string( D ) };
+
+    ecfcpp::random::seed( 1 );
+    auto const parents{ ecfcpp::factory::create( Chromosome{ -5, 5 }, 2, [](){ return ecfcpp::random::uniform( -5.0, 5.0 ); } ) };
+    auto       child  { parents[ 0 ] };
+
+    auto const real
+    {
+        [ & ]( std::string const & name, auto const & crossover )
+        {
+            suite.run
+            (
+                "crossover/" + name + suffix,
+                1,
+                [ & ]
+                {
+                    crossover( parents[ 0 ], parents[ 1 ], child );
+                    benchmark::keep( child );
+                }
+            );
+        }
+    };
+
+    real( "Arithmetical", ecfcpp::crossover::Arithmetical{ 0.3f } );
+    real( "BlxAlpha",     ecfcpp::crossover::BlxAlpha    { 0.2f } );
+    real( "Flat",         ecfcpp::crossover::Flat        {}       );
+    real( "SinglePoint",  ecfcpp::crossover::SinglePoint {}       );
+    real( "Uniform",      ecfcpp::crossover::Uniform     {}       );
+    real( "Composite",    ecfcpp::crossover::Composite{ ecfcpp::crossover::BlxAlpha{ 0.2f }, ecfcpp::crossover::Uniform{} } );
+
+    ecfcpp::Population< Binary > binaryParents( 2, Binary( -5, 5, 6 ) );
+    for ( auto & parent : binaryParents )
+    {
+        for ( auto && bit : parent.data() )
+        {
+            bit = ecfcpp::random::boolean();
+        }
+    }
+    auto binaryChild{ binaryParents[ 0 ] };
+
+    auto const binary
+    {
+        [ & ]( std::string const & name, auto const & crossover )
+        {
+            suite.run
+            (
+                "crossover/" + name + "/binary" + suffix,
+                1,
+                [ & ]
+                {
+                    crossover( binaryParents[ 0 ], binaryParents[ 1 ], binaryChild );
+                    benchmark::keep( binaryChild );
+                }
+            );
+        }
+    };
+
+    binary( "SinglePoint", ecfcpp::crossover::SinglePoint{} );
+    binary( "Uniform",     ecfcpp::crossover::Uniform    {} );
+}
+
+template< std::size_t D >
+void mutations( benchmark::Suite & suite )
+{
+    using Chromosome = ecfcpp::Array< double, D >;
+    using Binary     = ecfcpp::BinaryArray< double, D >;
+    using ecfcpp::mutation::Sampling;
+
+    auto const suffix{ "/d=" + std::to_string( D ) };
+
+    ecfcpp::random::seed( 2 );
+    auto individual{ ecfcpp::factory::create( Chromosome{ -5, 5 }, 1, [](){ return ecfcpp::random::uniform( -5.0, 5.0 ); } )[ 0 ] };
+
+    auto const real
+    {
+        [ & ]( std::string const & name, auto const & mutation )
+        {
+            suite.run
+            (
+                "mutation/" + name + suffix,
+                1,
+                [ & ]
+                {
+                    ecfcpp::mutation::inPlace( mutation, individual );
+                    benchmark::keep( individual );
+                }
+            );
+        }
+    };
+
+    using Gaussian = ecfcpp::mutation::Gaussian;
+
+    real( "Gaussian",      Gaussian{ 0.01f, true, 0.1f                                          } );
+    real( "Gaussian/Skip", Gaussian{ 0.01f, true, 0.1f, Gaussian::Type::Add, Sampling::Skip } );
+    real( "Composite",     ecfcpp::mutation::Composite{ Gaussian{ 0.01f, true, 0.1f }, Gaussian{ 0.01f, true, 1.0f } } );
+
+    Binary binary( -5, 5, 6 );
+    for ( auto && bit : binary.data() )
+    {
+        bit = ecfcpp::random::boolean();
+    }
+
+    auto const bits
+    {
+        [ & ]( std::string const & name, auto const & mutation )
+        {
+            suite.run
+            (
+                "mutation/" + name + "/binary" + suffix,
+                1,
+                [ & ]
+                {
+                    ecfcpp::mutation::inPlace( mutation, binary );
+                    benchmark::keep( binary );
+                }
+            );
+        }
+    };
+
+    bits( "BitFlip",      ecfcpp::mutation::BitFlip{ 0.01f, true                 } );
+    bits( "BitFlip/Skip", ecfcpp::mutation::BitFlip{ 0.01f, true, Sampling::Skip } );
+}
+
+template< std::size_t N >
+void selections( benchmark::Suite & suite )
+{
+    using Chromosome = ecfcpp::Array< double, 10 >;
+
+    auto const suffix{ "/n=" + std::to_string( N ) };
+
+    ecfcpp::random::seed( 3 );
+    auto population{ ecfcpp::factory::create( Chromosome{ -5, 5 }, N, [](){ return ecfcpp::random::uniform( -5.0, 5.0 ); } ) };
+    for ( auto & individual : population )
+    {
+        individual.fitness = -ecfcpp::function::sphere< Chromosome >( individual );
+    }
+
+    std::vector< std::size_t > indices( N );
+
+    auto const run
+    {
+        [ & ]( std::string const & name, auto const & selection )
+        {
+            suite.run
+            (
+                "selection/" + name + suffix,
+                1,
+                [ & ]
+                {
+                    benchmark::keep( selection( population ) );
+                }
+            );
+
+            suite.run
+            (
+                "selection/" + name + "/batch" + suffix,
+                N,
+                [ & ]
+                {
+                    selection.select( population, N, indices.data() );
+                    benchmark::keep( indices );
+                }
+            );
+        }
+    };
+
+    run( "Tournament",    ecfcpp::selection::Tournament   { 3 } );
+    run( "Rank",          ecfcpp::selection::Rank         {}    );
+    run( "RouletteWheel", ecfcpp::selection::RouletteWheel{}    );
+}
+
+}
+
+namespace benchmark
+{
+
+// Single applications of every crossover, mutation and selection.
+void operators( Suite & suite )
+{
+    crossovers< 10   >( suite );
+    crossovers< 100  >( suite );
+    crossovers< 1000 >( suite );
+
+    mutations< 10   >( suite );
+    mutations< 100  >( suite );
+    mutations< 1000 >( suite );
+
+    selections< 100  >( suite );
+    selections< 1000 >( suite );
+}
+
+}
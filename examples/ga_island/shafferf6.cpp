@@ -0,0 +1,56 @@
+#include <ecfcpp/ecfcpp.hpp>
+
+#include <cstddef>
+#include <iostream>
+
+int main()
+{
+    constexpr std::size_t numberOfComponents{ 10 };
+    constexpr std::size_t populationSize{ 400 };
+
+    constexpr std::size_t islandCount{ 4 };
+    constexpr std::size_t migrationInterval{ 25 };
+    constexpr std::size_t migrationSize{ 2 };
+
+    constexpr bool        enableElitism{ true };
+    constexpr std::size_t maxGenerations{ 100000 };
+    constexpr double      desiredFitness{ 0 };
+    constexpr double      precision{ 1e-5 };
+
+    constexpr std::size_t tournamentSize{ 3 };
+
+    constexpr float alpha{ 0.2 };
+
+    constexpr float mutationProbability{ 0.05 };
+    constexpr bool  forceMutation{ true };
+    constexpr float sigma{ 0.3 };
+
+    using Chromosome = ecfcpp::Array< double, numberOfComponents >;
+
+    constexpr auto function{ ecfcpp::function::CallCounter{ ecfcpp::function::shafferf6< Chromosome > } };
+
+    auto const result
+    {
+        ecfcpp::ga::island
+        (
+            ecfcpp::ga::model::Generational{ enableElitism },
+            islandCount,
+            ecfcpp::ga::Topology::Ring,
+            migrationInterval,
+            migrationSize,
+            maxGenerations,
+            desiredFitness,
+            precision,
+            ecfcpp::problem::Minimization{ function },
+            ecfcpp::selection::Tournament{ tournamentSize },
+            ecfcpp::crossover::BlxAlpha{ alpha },
+            ecfcpp::mutation::Gaussian{ mutationProbability, forceMutation, sigma },
+            ecfcpp::factory::create( Chromosome{ -100, 100 }, populationSize, [](){ return ecfcpp::random::uniform( -100, 100 ); } )
+        )
+    };
+
+    std::cout << "Found solution in " << function.callCount() << " function evaluations.\n";
+    std::cout << "Fitness: " << result.fitness << '\n';
+
+    return 0;
+}
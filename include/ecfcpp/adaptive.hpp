@@ -0,0 +1,127 @@
+#ifndef ECFCPP_ADAPTIVE_HPP
+#define ECFCPP_ADAPTIVE_HPP
+
+#include <ecfcpp/types.hpp>
+#include <ecfcpp/weighted.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+namespace ecfcpp
+{
+
+// Adaptive pursuit (Thierens, 2005) for operators of a composite. An operator
+// is rewarded whenever its offspring improves on the better parent. Once per
+// generation, quality of every operator used moves by adaptationRate towards
+// its success rate in that generation. Choice probabilities then move by
+// learningRate towards choosing the best operator as often as possible while
+// choosing every other one with at least minProbability, unless no operator
+// has a quality above zero and above all others. Every run starts from the
+// probabilities given by weights.
+struct AdaptivePursuit
+{
+    decimal_t adaptationRate{ 0.3f };
+    decimal_t learningRate  { 0.3f };
+    decimal_t minProbability{ 0.1f };
+};
+
+namespace detail
+{
+
+// Choice of one of N operators, with probabilities either fixed by weights or
+// adapted by pursuit. Rewards cost constant time; adapting costs O( N ).
+// Resetting forgets what adaptation learned.
+template< std::size_t N >
+class OperatorChoice
+{
+public:
+    constexpr OperatorChoice( std::array< decimal_t, N > const & weights ) noexcept :
+        table_  { weights },
+        initial_{ weights }
+    {}
+
+    constexpr OperatorChoice( AdaptivePursuit const & pursuit, std::array< decimal_t, N > const & weights ) noexcept :
+        table_   { weights },
+        initial_ { weights },
+        pursuit_ { pursuit },
+        adaptive_{ true    }
+    {}
+
+    inline std::size_t choose() const noexcept { return table_.choose(); }
+
+    constexpr decimal_t probability( std::size_t const i ) const noexcept { return table_.probability( i ); }
+
+    constexpr bool adaptive() const noexcept { return adaptive_; }
+
+    inline void reward( std::size_t const i, double const improvement ) noexcept
+    {
+        if ( improvement > 0 )
+        {
+            ++rewards_[ i ];
+        }
+        ++counts_[ i ];
+    }
+
+    void adapt() noexcept
+    {
+        if ( !adaptive_ )
+        {
+            return;
+        }
+
+        for ( std::size_t i{ 0 }; i < N; ++i )
+        {
+            if ( counts_[ i ] > 0 )
+            {
+                auto const successRate{ rewards_[ i ] / static_cast< double >( counts_[ i ] ) };
+                quality_[ i ] += pursuit_.adaptationRate * ( successRate - quality_[ i ] );
+            }
+        }
+
+        rewards_.fill( 0 );
+        counts_ .fill( 0 );
+
+        // Without a single best operator there is nothing to pursue, and
+        // picking the first of equals would favour it for no reason.
+        auto const best{ static_cast< std::size_t >( std::max_element( std::begin( quality_ ), std::end( quality_ ) ) - std::begin( quality_ ) ) };
+        if ( quality_[ best ] <= 0 || std::count( std::begin( quality_ ), std::end( quality_ ), quality_[ best ] ) > 1 )
+        {
+            return;
+        }
+
+        auto const minimum{ std::min( pursuit_.minProbability, decimal_t{ 1 } / N ) };
+        auto const maximum{ 1 - ( N - 1 ) * minimum };
+
+        std::array< decimal_t, N > probabilities;
+        for ( std::size_t i{ 0 }; i < N; ++i )
+        {
+            auto const target{ i == best ? maximum : minimum };
+            probabilities[ i ] = table_.probability( i ) + pursuit_.learningRate * ( target - table_.probability( i ) );
+        }
+        table_ = WeightTable< N >{ probabilities };
+    }
+
+    void reset() noexcept
+    {
+        table_ = initial_;
+        quality_.fill( 0 );
+        rewards_.fill( 0 );
+        counts_ .fill( 0 );
+    }
+
+private:
+    WeightTable< N >             table_;
+    WeightTable< N >             initial_;
+    AdaptivePursuit              pursuit_ {};
+    bool                         adaptive_{ false };
+    std::array< double, N >      quality_ {};
+    std::array< std::size_t, N > rewards_ {};
+    std::array< std::size_t, N > counts_  {};
+};
+
+}
+
+}
+
+#endif // ECFCPP_ADAPTIVE_HPP
@@ -0,0 +1,256 @@
+#ifndef ECFCPP_BIT_VECTOR_HPP
+#define ECFCPP_BIT_VECTOR_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace ecfcpp
+{
+
+// Sequence of bits packed into 64-bit words.
+//
+// Bit i is bit i % 64 of word i / 64. Bits past size() in the last word are
+// always zero, so words can be compared, counted and combined directly.
+// Individual bits are accessed through proxy references, in the manner of
+// std::vector< bool >.
+class BitVector
+{
+public:
+    using word_type       = std::uint64_t;
+    using value_type      = bool;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    static constexpr std::size_t wordBits{ 64 };
+
+    class reference
+    {
+    public:
+        constexpr reference( word_type * const word, word_type const mask ) noexcept : word_{ word }, mask_{ mask } {}
+
+        constexpr reference( reference const & ) noexcept = default;
+
+        constexpr inline operator bool() const noexcept { return ( *word_ & mask_ ) != 0; }
+
+        constexpr inline reference & operator=( bool const value ) noexcept
+        {
+            *word_ = value ? *word_ | mask_ : *word_ & ~mask_;
+            return *this;
+        }
+
+        constexpr inline reference & operator=( reference const & rhs ) noexcept { return *this = static_cast< bool >( rhs ); }
+
+        constexpr inline bool operator~() const noexcept { return !static_cast< bool >( *this ); }
+
+        constexpr inline void flip() noexcept { *word_ ^= mask_; }
+
+        friend constexpr inline void swap( reference lhs, reference rhs ) noexcept
+        {
+            bool const value{ lhs };
+            lhs = rhs;
+            rhs = value;
+        }
+
+    private:
+        word_type * word_;
+        word_type   mask_;
+    };
+
+    using const_reference = bool;
+
+    template< bool Const >
+    class Iterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = bool;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = std::conditional_t< Const, bool, BitVector::reference >;
+
+        using word_pointer = std::conditional_t< Const, word_type const *, word_type * >;
+
+        constexpr Iterator() noexcept = default;
+
+        constexpr Iterator( word_pointer const words, std::size_t const index ) noexcept : words_{ words }, index_{ index } {}
+
+        template< bool OtherConst, typename = std::enable_if_t< Const && !OtherConst > >
+        constexpr Iterator( Iterator< OtherConst > const & other ) noexcept : words_{ other.words_ }, index_{ other.index_ } {}
+
+        constexpr inline reference operator*() const noexcept
+        {
+            if constexpr ( Const )
+            {
+                return ( words_[ index_ / wordBits ] >> index_ % wordBits & 1 ) != 0;
+            }
+            else
+            {
+                return { words_ + index_ / wordBits, word_type{ 1 } << index_ % wordBits };
+            }
+        }
+
+        constexpr inline reference operator[]( difference_type const n ) const noexcept { return *( *this + n ); }
+
+        constexpr inline Iterator & operator++()    noexcept { ++index_; return *this; }
+        constexpr inline Iterator & operator--()    noexcept { --index_; return *this; }
+        constexpr inline Iterator   operator++( int ) noexcept { auto copy{ *this }; ++index_; return copy; }
+        constexpr inline Iterator   operator--( int ) noexcept { auto copy{ *this }; --index_; return copy; }
+
+        constexpr inline Iterator & operator+=( difference_type const n ) noexcept { index_ = static_cast< std::size_t >( static_cast< difference_type >( index_ ) + n ); return *this; }
+        constexpr inline Iterator & operator-=( difference_type const n ) noexcept { return *this += -n; }
+
+        constexpr inline Iterator operator+( difference_type const n ) const noexcept { auto copy{ *this }; return copy += n; }
+        constexpr inline Iterator operator-( difference_type const n ) const noexcept { auto copy{ *this }; return copy -= n; }
+
+        friend constexpr inline Iterator operator+( difference_type const n, Iterator const & it ) noexcept { return it + n; }
+
+        constexpr inline difference_type operator-( Iterator const & rhs ) const noexcept
+        {
+            return static_cast< difference_type >( index_ ) - static_cast< difference_type >( rhs.index_ );
+        }
+
+        constexpr inline bool operator==( Iterator const & rhs ) const noexcept { return index_ == rhs.index_; }
+        constexpr inline bool operator!=( Iterator const & rhs ) const noexcept { return index_ != rhs.index_; }
+        constexpr inline bool operator< ( Iterator const & rhs ) const noexcept { return index_ <  rhs.index_; }
+        constexpr inline bool operator> ( Iterator const & rhs ) const noexcept { return index_ >  rhs.index_; }
+        constexpr inline bool operator<=( Iterator const & rhs ) const noexcept { return index_ <= rhs.index_; }
+        constexpr inline bool operator>=( Iterator const & rhs ) const noexcept { return index_ >= rhs.index_; }
+
+    private:
+        template< bool > friend class Iterator;
+
+        word_pointer words_{ nullptr };
+        std::size_t  index_{ 0       };
+    };
+
+    using iterator       = Iterator< false >;
+    using const_iterator = Iterator< true  >;
+
+    BitVector() = default;
+
+    explicit BitVector( std::size_t const size, bool const value = false ) :
+        size_ { size                                                  },
+        words_( wordCount( size ), value ? ~word_type{ 0 } : word_type{ 0 } )
+    {
+        clearTail();
+    }
+
+    inline reference operator[]( std::size_t const index ) noexcept
+    {
+        assert( index < size_ );
+        return { words_.data() + index / wordBits, word_type{ 1 } << index % wordBits };
+    }
+
+    inline bool operator[]( std::size_t const index ) const noexcept
+    {
+        assert( index < size_ );
+        return ( words_[ index / wordBits ] >> index % wordBits & 1 ) != 0;
+    }
+
+    inline void flip( std::size_t const index ) noexcept
+    {
+        assert( index < size_ );
+        words_[ index / wordBits ] ^= word_type{ 1 } << index % wordBits;
+    }
+
+    // Count bits starting at position as an unsigned integer whose least
+    // significant bit is the bit at position. Count is at most 64.
+    inline word_type bits( std::size_t const position, std::size_t const count ) const noexcept
+    {
+        assert( count <= wordBits && position + count <= size_ );
+
+        if ( count == 0 )
+        {
+            return 0;
+        }
+
+        auto const word  { position / wordBits };
+        auto const offset{ position % wordBits };
+
+        auto result{ words_[ word ] >> offset };
+        if ( offset + count > wordBits )
+        {
+            result |= words_[ word + 1 ] << ( wordBits - offset );
+        }
+        return result & lowMask( count );
+    }
+
+    // Replaces count bits starting at position with the low bits of value.
+    inline void setBits( std::size_t const position, std::size_t const count, word_type const value ) noexcept
+    {
+        assert( count <= wordBits && position + count <= size_ );
+
+        if ( count == 0 )
+        {
+            return;
+        }
+
+        auto const word  { position / wordBits };
+        auto const offset{ position % wordBits };
+        auto const mask  { lowMask( count ) };
+        auto const masked{ value & mask };
+
+        words_[ word ] = ( words_[ word ] & ~( mask << offset ) ) | masked << offset;
+        if ( offset + count > wordBits )
+        {
+            auto const shift{ wordBits - offset };
+            words_[ word + 1 ] = ( words_[ word + 1 ] & ~( mask >> shift ) ) | masked >> shift;
+        }
+    }
+
+    // Number of set bits.
+    inline std::size_t count() const noexcept
+    {
+        std::size_t result{ 0 };
+        for ( auto const word : words_ )
+        {
+            result += static_cast< std::size_t >( __builtin_popcountll( word ) );
+        }
+        return result;
+    }
+
+    inline bool operator==( BitVector const & rhs ) const noexcept { return size_ == rhs.size_ && words_ == rhs.words_; }
+    inline bool operator!=( BitVector const & rhs ) const noexcept { return !( *this == rhs ); }
+
+    inline std::size_t size () const noexcept { return size_;      }
+    inline bool        empty() const noexcept { return size_ == 0; }
+
+    // Words holding the bits. Bits past size() in the last word must stay zero.
+    inline word_type       * words()       noexcept { return words_.data(); }
+    inline word_type const * words() const noexcept { return words_.data(); }
+
+    inline std::size_t wordCount() const noexcept { return std::size( words_ ); }
+
+    inline iterator begin() noexcept { return { words_.data(), 0     }; }
+    inline iterator end  () noexcept { return { words_.data(), size_ }; }
+
+    inline const_iterator begin() const noexcept { return { words_.data(), 0     }; }
+    inline const_iterator end  () const noexcept { return { words_.data(), size_ }; }
+
+    static constexpr std::size_t wordCount( std::size_t const bits ) noexcept { return ( bits + wordBits - 1 ) / wordBits; }
+
+private:
+    static constexpr word_type lowMask( std::size_t const count ) noexcept
+    {
+        return count >= wordBits ? ~word_type{ 0 } : ( word_type{ 1 } << count ) - 1;
+    }
+
+    inline void clearTail() noexcept
+    {
+        if ( size_ % wordBits != 0 )
+        {
+            words_.back() &= lowMask( size_ % wordBits );
+        }
+    }
+
+    std::size_t              size_{ 0 };
+    std::vector< word_type > words_;
+};
+
+}
+
+#endif // ECFCPP_BIT_VECTOR_HPP
@@ -1,20 +1,35 @@
 #ifndef ECFCPP_BOUNDED_ARRAY_HPP
 #define ECFCPP_BOUNDED_ARRAY_HPP
 
+#include <ecfcpp/bounds.hpp>
+#include <ecfcpp/span.hpp>
+
 #include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstddef>
+#include <limits>
 #include <type_traits>
 
 namespace ecfcpp
 {
 
-template< typename T, std::size_t N, typename = std::enable_if_t< std::is_arithmetic_v< T > > >
+// Genes with bounds. Genes are stored and read as written; repair() brings
+// them back into bounds according to the Bound policy.
+template
+<
+    typename    T,
+    std::size_t N,
+    typename    Bound = bound::Clamp,
+    typename =  std::enable_if_t< std::is_arithmetic_v< T > >
+>
 class BoundedArray
 {
 public:
-    using value_type = T;
+    using value_type     = T;
+    using bound_type     = Bound;
+    using iterator       = value_type *;
+    using const_iterator = value_type const *;
 
     constexpr BoundedArray() = default;
 
@@ -27,6 +42,7 @@ public:
         upperBound_{ upperBound }
     {
         assert( lowerBound_ <= upperBound_ );
+        data_.fill( std::clamp( value_type{}, lowerBound_, upperBound_ ) );
     }
 
     constexpr BoundedArray( BoundedArray const & other ) :
@@ -44,16 +60,25 @@ public:
     constexpr inline value_type operator[]( std::size_t const index ) const
     {
         assert( index < N );
-        return std::clamp( data_[ index ], lowerBound_, upperBound_ );
+        return data_[ index ];
     }
 
     constexpr inline value_type & operator[]( std::size_t const index )
     {
         assert( index < N );
-        data_[ index ] = std::clamp( data_[ index ], lowerBound_, upperBound_ );
         return data_[ index ];
     }
 
+    // Applies the bound policy to all genes.
+    constexpr inline void repair() { Bound{}( begin(), end(), lowerBound_, upperBound_ ); }
+
+    // Applies the bound policy to gene index only.
+    constexpr inline void repair( std::size_t const index )
+    {
+        assert( index < N );
+        Bound{}( data() + index, data() + index + 1, lowerBound_, upperBound_ );
+    }
+
     constexpr inline bool operator< ( BoundedArray const & rhs ) const { return data_ < rhs.data_; }
     constexpr inline bool operator> ( BoundedArray const & rhs ) const { return rhs < *this;           }
     constexpr inline bool operator<=( BoundedArray const & rhs ) const { return !( *this > rhs );      }
@@ -78,82 +103,23 @@ public:
         return *this;
     }
 
-    class iterator
-    {
-    public:
-        using iterator_category = std::input_iterator_tag;
-        using value_type        = BoundedArray::value_type;
-        using difference_type   = std::ptrdiff_t;
-        using pointer           = value_type *;
-        using reference         = value_type &;
-
-        explicit constexpr iterator
-        (
-            BoundedArray       & array,
-            std::size_t  const   index
-        ) :
-            array_{ array },
-            index_{ index }
-        {}
-
-        inline bool operator==( iterator const & other ) const
-        {
-            return index_ == other.index_ && &array_ == &other.array_;
-        }
-
-        inline bool operator!=( iterator const & other ) const { return !( *this == other ); }
-
-        inline iterator & operator++() { ++index_; return *this; }
-
-        inline reference operator*() { return array_[ index_ ]; }
-
-    private:
-        BoundedArray & array_;
-        std::size_t    index_;
-    };
+    constexpr inline auto size() const { return N; }
 
-    class const_iterator
-    {
-    public:
-        using iterator_category = std::input_iterator_tag;
-        using value_type        = BoundedArray::value_type;
-        using difference_type   = std::ptrdiff_t;
-        using pointer           = value_type *;
-        using reference         = value_type &;
-
-        explicit constexpr const_iterator
-        (
-            BoundedArray const & array,
-            std::size_t  const   index
-        ) :
-            array_{ array },
-            index_{ index }
-        {}
-
-        inline bool operator==( const_iterator const & other ) const
-        {
-            return index_ == other.index_ && &array_ == &other.array_;
-        }
-
-        inline bool operator!=( const_iterator const & other ) const { return !( *this == other ); }
-
-        inline const_iterator & operator++() { ++index_; return *this; }
-
-        // Returning value_type should be OK since value_type is arithmetic.
-        inline value_type operator*() const { return array_[ index_ ]; }
-
-    private:
-        BoundedArray const & array_;
-        std::size_t          index_;
-    };
+    constexpr inline auto lowerBound() const { return lowerBound_; }
+    constexpr inline auto upperBound() const { return upperBound_; }
 
-    constexpr inline auto size() const { return N; }
+    // Genes are contiguous, so iterators and views are plain pointers.
+    constexpr inline value_type       * data()       noexcept { return data_.data(); }
+    constexpr inline value_type const * data() const noexcept { return data_.data(); }
+
+    constexpr inline Span< value_type       > genes()       noexcept { return { data_.data(), N }; }
+    constexpr inline Span< value_type const > genes() const noexcept { return { data_.data(), N }; }
 
-    constexpr inline auto begin() const { return const_iterator( *this, 0 ); }
-    constexpr inline auto end  () const { return const_iterator( *this, N ); }
+    constexpr inline const_iterator begin() const noexcept { return data_.data();     }
+    constexpr inline const_iterator end  () const noexcept { return data_.data() + N; }
 
-    constexpr inline auto begin() { return iterator( *this, 0 ); }
-    constexpr inline auto end  () { return iterator( *this, N ); }
+    constexpr inline iterator begin() noexcept { return data_.data();     }
+    constexpr inline iterator end  () noexcept { return data_.data() + N; }
 
 private:
     std::array< value_type, N > data_{};
@@ -0,0 +1,225 @@
+#ifndef ECFCPP_BOUNDS_HPP
+#define ECFCPP_BOUNDS_HPP
+
+#include <ecfcpp/utils/random.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+// Policies bringing genes back into [lower, upper] once variation is done.
+// A policy repairs a whole range of genes in one pass,
+// policy( first, last, lower, upper ), and leaves genes within bounds as
+// they are. Loops over contiguous genes are simple enough to be vectorized.
+namespace ecfcpp::bound
+{
+
+namespace detail
+{
+
+// Non-negative remainder of value divided by period.
+template< typename T >
+T modulo( T const value, T const period ) noexcept
+{
+    auto const remainder{ std::fmod( value, period ) };
+    return remainder < 0 ? remainder + period : remainder;
+}
+
+// Integer arithmetic on genes is done on their unsigned counterparts, where
+// the distance between any two values, e.g. the bounds of the whole type, is
+// representable.
+template< typename T >
+using unsigned_t = std::make_unsigned_t< T >;
+
+template< typename T >
+constexpr unsigned_t< T > distance( T const from, T const to ) noexcept
+{
+    return static_cast< unsigned_t< T > >( static_cast< unsigned_t< T > >( to ) - static_cast< unsigned_t< T > >( from ) );
+}
+
+template< typename T >
+constexpr T advance( T const from, unsigned_t< T > const by ) noexcept
+{
+    return static_cast< T >( static_cast< unsigned_t< T > >( static_cast< unsigned_t< T > >( from ) + by ) );
+}
+
+template< typename T >
+constexpr T retreat( T const from, unsigned_t< T > const by ) noexcept
+{
+    return static_cast< T >( static_cast< unsigned_t< T > >( static_cast< unsigned_t< T > >( from ) - by ) );
+}
+
+}
+
+// Leaves genes unchanged.
+struct None
+{
+    template< typename Iterator, typename T >
+    constexpr void operator()( Iterator, Iterator, T, T ) const noexcept {}
+};
+
+// Moves genes to the nearest bound.
+struct Clamp
+{
+    template< typename Iterator, typename T >
+    constexpr void operator()( Iterator first, Iterator const last, T const lower, T const upper ) const noexcept
+    {
+        for ( ; first != last; ++first )
+        {
+            T const value( *first );
+            *first = value < lower ? lower : upper < value ? upper : value;
+        }
+    }
+};
+
+// Mirrors genes at the bounds they crossed, as many times as needed.
+struct Reflect
+{
+    template< typename Iterator, typename T >
+    constexpr void operator()( Iterator first, Iterator const last, T const lower, T const upper ) const noexcept
+    {
+        if constexpr ( std::is_floating_point_v< T > )
+        {
+            T const width ( upper - lower );
+            T const period( 2 * width     );
+            for ( ; first != last; ++first )
+            {
+                T const value( *first );
+                if ( value < lower || upper < value )
+                {
+                    T const offset( width == 0 ? T{} : detail::modulo< T >( value - lower, period ) );
+                    *first = offset <= width ? lower + offset : upper - ( offset - width );
+                }
+            }
+        }
+        else
+        {
+            // A gene beyond a bound by a whole number of widths ends on a bound,
+            // on the crossed one after an even number of them.
+            auto const width{ detail::distance( lower, upper ) };
+            for ( ; first != last; ++first )
+            {
+                T const value( *first );
+                if ( value < lower || upper < value )
+                {
+                    auto const below { value < lower };
+                    auto const beyond{ below ? detail::distance( value, lower ) : detail::distance( upper, value ) };
+
+                    if ( width == 0 )
+                    {
+                        *first = lower;
+                    }
+                    else if ( ( beyond / width ) % 2 == 0 )
+                    {
+                        *first = below ? detail::advance( lower, beyond % width ) : detail::retreat( upper, beyond % width );
+                    }
+                    else
+                    {
+                        *first = below ? detail::retreat( upper, beyond % width ) : detail::advance( lower, beyond % width );
+                    }
+                }
+            }
+        }
+    }
+};
+
+// Treats the interval as periodic, so that leaving through one bound enters
+// through the other.
+struct Wrap
+{
+    template< typename Iterator, typename T >
+    constexpr void operator()( Iterator first, Iterator const last, T const lower, T const upper ) const noexcept
+    {
+        if constexpr ( std::is_floating_point_v< T > )
+        {
+            T const period( upper - lower );
+            for ( ; first != last; ++first )
+            {
+                T const value( *first );
+                if ( value < lower || upper < value )
+                {
+                    *first = period == 0 ? lower : lower + detail::modulo< T >( value - lower, period );
+                }
+            }
+        }
+        else
+        {
+            // Both bounds are valid integers, so the period is one longer than
+            // the width. Genes can leave only bounds narrower than the type, so
+            // the period is representable whenever it is needed.
+            auto const width{ detail::distance( lower, upper ) };
+            for ( ; first != last; ++first )
+            {
+                T const value( *first );
+                if ( value < lower )
+                {
+                    *first = detail::retreat( upper, ( detail::distance( value, lower ) - 1 ) % ( width + 1 ) );
+                }
+                else if ( upper < value )
+                {
+                    *first = detail::advance( lower, detail::distance( lower, value ) % ( width + 1 ) );
+                }
+            }
+        }
+    }
+};
+
+// Replaces genes out of bounds with uniformly random ones.
+struct Resample
+{
+    template< typename Iterator, typename T >
+    void operator()( Iterator first, Iterator const last, T const lower, T const upper ) const noexcept
+    {
+        for ( ; first != last; ++first )
+        {
+            T const value( *first );
+            if ( value < lower || upper < value )
+            {
+                *first = draw( lower, upper );
+            }
+        }
+    }
+
+private:
+    // Integers are drawn from the closed interval, which may span the type.
+    template< typename T >
+    static T draw( T const lower, T const upper ) noexcept
+    {
+        if constexpr ( std::is_floating_point_v< T > )
+        {
+            return random::uniform( lower, upper );
+        }
+        else
+        {
+            auto const width{ std::uint64_t{ detail::distance( lower, upper ) } };
+            auto const offset
+            {
+                width == std::numeric_limits< std::uint64_t >::max() ? random::bits() : random::stream().bounded( width + 1 )
+            };
+            return detail::advance< T >( lower, offset );
+        }
+    }
+};
+
+template< typename Individual, typename = void >
+struct HasRepair : std::false_type {};
+
+template< typename Individual >
+struct HasRepair< Individual, std::void_t< decltype( std::declval< Individual >().repair() ) > > : std::true_type {};
+
+// Brings genes of individual into its bounds. Individuals which cannot leave
+// their bounds, such as binary ones, are left as they are.
+template< typename Individual >
+constexpr void repair( Individual && individual )
+{
+    if constexpr ( HasRepair< Individual && >::value )
+    {
+        individual.repair();
+    }
+}
+
+}
+
+#endif // ECFCPP_BOUNDS_HPP
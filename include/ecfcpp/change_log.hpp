@@ -0,0 +1,193 @@
+#ifndef ECFCPP_CHANGE_LOG_HPP
+#define ECFCPP_CHANGE_LOG_HPP
+
+#include <ecfcpp/span.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ecfcpp
+{
+
+// Genes of an individual changed since its score was last computed, each with
+// the value it had back then. Separable objectives use it to update the score
+// in time proportional to the number of changes, see IsDeltaFunction. A new
+// log, or one which lost track of changes, asks for full evaluation.
+template< typename T >
+class ChangeLog
+{
+public:
+    using value_type = T;
+
+    struct Change
+    {
+        std::size_t index;
+        T           previous;
+    };
+
+    // Delta updates accumulate rounding errors, so after this many of them in
+    // a row the individual is evaluated in full.
+    static constexpr std::uint32_t refreshInterval{ 64 };
+
+    // Log stops tracking once it holds more than limit changes, since such
+    // individuals are evaluated in full about as fast.
+    explicit ChangeLog( std::size_t const limit = std::numeric_limits< std::size_t >::max() ) : limit_{ limit } {}
+
+    // Records that gene index had value previous before it was changed.
+    inline void record( std::size_t const index, T const previous )
+    {
+        if ( !tracked_ )
+        {
+            return;
+        }
+
+        if ( std::size( changes_ ) >= limit_ )
+        {
+            invalidate();
+            return;
+        }
+
+        changes_.push_back( { index, previous } );
+    }
+
+    // Assigns value to gene, which is gene index of the individual, recording
+    // the change if there is one.
+    template< typename Gene, typename Value >
+    constexpr void write( Gene && gene, std::size_t const index, Value const value )
+    {
+        T const next( value );
+        if ( gene != next )
+        {
+            record( index, gene );
+            gene = next;
+        }
+    }
+
+    // Individual changed in ways the log does not know about.
+    inline void invalidate() noexcept
+    {
+        tracked_ = false;
+        changes_.clear();
+    }
+
+    // Score was computed from the current genes.
+    inline void reset() noexcept
+    {
+        tracked_ = true;
+        updates_ = 0;
+        changes_.clear();
+    }
+
+    // Score was updated by the recorded changes.
+    inline void commit() noexcept
+    {
+        ++updates_;
+        changes_.clear();
+    }
+
+    // Score is still valid.
+    inline bool unchanged() const noexcept { return tracked_ && changes_.empty(); }
+
+    // Score can be updated from changes instead of computed in full.
+    inline bool updatable() const noexcept { return tracked_ && updates_ < refreshInterval; }
+
+    inline bool tracked() const noexcept { return tracked_; }
+
+    // Recorded changes in order, possibly listing a gene more than once.
+    inline Span< Change const > records() const noexcept { return { changes_.data(), std::size( changes_ ) }; }
+
+    // Changes listing every gene once, with its value when the score was
+    // computed.
+    Span< Change const > changes()
+    {
+        // Marks of genes already seen, kept per thread so that logs of
+        // different individuals can be processed concurrently.
+        static thread_local std::vector< bool > seen;
+
+        std::size_t kept{ 0 };
+        for ( std::size_t i{ 0 }; i < std::size( changes_ ); ++i )
+        {
+            auto const change{ changes_[ i ] };
+            if ( change.index >= std::size( seen ) )
+            {
+                seen.resize( change.index + 1 );
+            }
+
+            if ( !seen[ change.index ] )
+            {
+                seen[ change.index ] = true;
+                changes_[ kept++ ] = change;
+            }
+        }
+        changes_.resize( kept );
+
+        for ( auto const & change : changes_ )
+        {
+            seen[ change.index ] = false;
+        }
+
+        return { changes_.data(), kept };
+    }
+
+private:
+    std::vector< Change > changes_;
+    std::size_t           limit_;
+    std::uint32_t         updates_{ 0     };
+    bool                  tracked_{ false };
+};
+
+// Stands in for a change log where changes are not tracked.
+struct NoChangeLog
+{
+    template< typename Gene, typename Value >
+    constexpr void write( Gene && gene, std::size_t, Value const value ) const { gene = value; }
+
+    constexpr void invalidate() const noexcept {}
+};
+
+template< typename T >
+struct IsChangeLog : std::false_type {};
+
+template< typename T >
+struct IsChangeLog< ChangeLog< T > > : std::true_type {};
+
+template<>
+struct IsChangeLog< NoChangeLog > : std::true_type {};
+
+template< typename T >
+constexpr inline bool isChangeLog{ IsChangeLog< std::remove_cv_t< std::remove_reference_t< T > > >::value };
+
+// Functions which can update the score of point after changes, a sequence of
+// ChangeLog::Change, are called as function.delta( point, changes ) and return
+// new score minus the old one.
+template< typename Function, typename Point, typename = void >
+struct IsDeltaFunction : std::false_type {};
+
+template< typename Function, typename Point >
+struct IsDeltaFunction
+<
+    Function,
+    Point,
+    std::void_t
+    <
+        decltype
+        (
+            std::declval< Function const & >().delta
+            (
+                std::declval< Point const & >(),
+                std::declval< Span< typename ChangeLog< typename Point::value_type >::Change const > >()
+            )
+        )
+    >
+> : std::true_type {};
+
+template< typename Function, typename Point >
+constexpr inline bool isDeltaFunction{ IsDeltaFunction< Function, Point >::value };
+
+}
+
+#endif // ECFCPP_CHANGE_LOG_HPP
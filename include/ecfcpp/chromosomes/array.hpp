@@ -2,6 +2,7 @@
 #define ECFCPP_CHROMOSOMES_ARRAY_HPP
 
 #include <ecfcpp/bounded_array.hpp>
+#include <ecfcpp/bounds.hpp>
 #include <ecfcpp/constants.hpp>
 #include <ecfcpp/types.hpp>
 
@@ -22,6 +23,7 @@ template
     typename    T,
     std::size_t N,
     typename    Decimal = std::conditional_t< std::is_floating_point_v< T >, T, decimal_t >,
+    typename    Bound   = bound::Clamp,
     typename =  std::enable_if_t< std::is_arithmetic_v< T > >
 >
 class Array
@@ -29,6 +31,7 @@ class Array
 public:
     using value_type = T;
     using decimal_t  = Decimal;
+    using bound_type = Bound;
 
     constexpr Array() = default;
 
@@ -101,8 +104,17 @@ public:
     constexpr auto       & data()       { return data_; }
     constexpr auto const & data() const { return data_; }
 
+    // Contiguous view of the genes.
+    constexpr auto genes()       noexcept { return data_.genes(); }
+    constexpr auto genes() const noexcept { return data_.genes(); }
+
     constexpr auto size() const { return N; }
 
+    // Brings genes back into bounds, see BoundedArray.
+    constexpr void repair() { data_.repair(); }
+
+    constexpr void repair( std::size_t const index ) { data_.repair( index ); }
+
     constexpr auto begin() { return std::begin( data_ ); }
     constexpr auto end  () { return std::end  ( data_ ); }
 
@@ -110,7 +122,7 @@ public:
     constexpr auto end  () const { return std::end  ( data_ ); }
 
 private:
-    BoundedArray< value_type, N > data_{};
+    BoundedArray< value_type, N, Bound > data_{};
 
 public:
     decimal_t fitness{ constant::worstFitness< decimal_t >() };
@@ -1,22 +1,32 @@
 #ifndef ECFCPP_CHROMOSOMES_BINARY_ARRAY_HPP
 #define ECFCPP_CHROMOSOMES_BINARY_ARRAY_HPP
 
+#include <ecfcpp/bit_vector.hpp>
+#include <ecfcpp/constants.hpp>
 #include <ecfcpp/types.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
+#include <ostream>
 #include <type_traits>
-#include <vector>
+#include <utility>
 
 namespace ecfcpp
 {
 
+// Real vector of N genes in [lowerBound, upperBound], each encoded in as many
+// bits as the requested number of decimal places needs. With Cache, decoded
+// genes are kept until the genotype is modified.
 template
 <
     typename    T,
     std::size_t N,
+    bool        Cache = false,
     typename =  std::enable_if_t< std::is_floating_point_v< T > >
 >
 class BinaryArray
@@ -47,8 +57,9 @@ public:
                 )
             )
         },
-        maxValue_{ static_cast< uint32_t >( 1 << chromosomeLength_ ) - 1 },
-        data_( N * chromosomeLength_, 0 )
+        maxValue_{ chromosomeLength_ >= 64 ? ~std::uint64_t{ 0 } : ( std::uint64_t{ 1 } << chromosomeLength_ ) - 1 },
+        scale_   { boundWidth_ / static_cast< value_type >( maxValue_ )                                             },
+        data_( N * chromosomeLength_ )
     {
         assert( lowerBound        <= upperBound );
         assert( chromosomeLength_ <= 64         );
@@ -62,14 +73,32 @@ public:
     {
         assert( index < N );
 
-        value_type result{ 0 };
-        std::uint32_t base{ 1 };
-        for ( std::size_t i{ index * chromosomeLength_ }; i < ( index + 1 ) * chromosomeLength_; ++i )
+        if constexpr ( Cache )
         {
-            result += data_[ i ] ? base : 0;
-            base *= 2;
+            return decoded()[ index ];
+        }
+        else
+        {
+            return decodeGene( index );
+        }
+    }
+
+    // Writes all N genes to out, which must accept N values.
+    template< typename OutputIterator >
+    constexpr OutputIterator decode( OutputIterator out ) const
+    {
+        if constexpr ( Cache )
+        {
+            return std::copy( std::begin( decoded() ), std::end( decoded() ), out );
+        }
+        else
+        {
+            for ( std::size_t i{ 0 }; i < N; ++i )
+            {
+                *out++ = decodeGene( i );
+            }
+            return out;
         }
-        return lowerBound_ + result * boundWidth_ / maxValue_;
     }
 
     constexpr inline bool operator< ( BinaryArray const & rhs ) const { return fitness < rhs.fitness; }
@@ -88,7 +117,9 @@ public:
         precision_        = rhs.precision_;
         chromosomeLength_ = rhs.chromosomeLength_;
         maxValue_         = rhs.maxValue_;
+        scale_            = rhs.scale_;
         data_             = rhs.data_;
+        cache_            = rhs.cache_;
         return *this;
     }
 
@@ -100,7 +131,9 @@ public:
         precision_        = rhs.precision_;
         chromosomeLength_ = rhs.chromosomeLength_;
         maxValue_         = rhs.maxValue_;
+        scale_            = rhs.scale_;
         data_             = std::move( rhs.data_ );
+        cache_            = rhs.cache_;
         return *this;
     }
 
@@ -129,94 +162,126 @@ public:
         return stream;
     }
 
-    class iterator
+    // Genes are decoded on access, so iterators yield values.
+    class const_iterator
     {
     public:
-        using iterator_category = std::input_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
         using value_type        = BinaryArray::value_type;
         using difference_type   = std::ptrdiff_t;
-        using pointer           = value_type *;
-        using reference         = value_type &;
+        using pointer           = value_type const *;
+        using reference         = value_type;
+
+        constexpr const_iterator() noexcept = default;
 
-        explicit constexpr iterator
+        explicit constexpr const_iterator
         (
-            BinaryArray       & array,
+            BinaryArray const & array,
             std::size_t const   index
         ) :
-            array_{ array },
-            index_{ index }
+            array_{ &array },
+            index_{ index  }
         {}
 
-        inline bool operator==( iterator const & other ) const
-        {
-            return index_ == other.index_ && &array_ == &other.array_;
-        }
+        constexpr inline value_type operator*() const { return ( *array_ )[ index_ ]; }
 
-        inline bool operator!=( iterator const & other ) const { return !( *this == other ); }
+        constexpr inline value_type operator[]( difference_type const n ) const { return *( *this + n ); }
 
-        inline iterator & operator++() { ++index_; return *this; }
+        constexpr inline const_iterator & operator++()    noexcept { ++index_; return *this; }
+        constexpr inline const_iterator & operator--()    noexcept { --index_; return *this; }
+        constexpr inline const_iterator   operator++( int ) noexcept { auto copy{ *this }; ++index_; return copy; }
+        constexpr inline const_iterator   operator--( int ) noexcept { auto copy{ *this }; --index_; return copy; }
 
-        inline reference operator*() { return array_[ index_ ]; }
+        constexpr inline const_iterator & operator+=( difference_type const n ) noexcept
+        {
+            index_ = static_cast< std::size_t >( static_cast< difference_type >( index_ ) + n );
+            return *this;
+        }
 
-    private:
-        BinaryArray & array_;
-        std::size_t   index_;
-    };
+        constexpr inline const_iterator & operator-=( difference_type const n ) noexcept { return *this += -n; }
 
-    class const_iterator
-    {
-    public:
-        using iterator_category = std::input_iterator_tag;
-        using value_type        = BinaryArray::value_type;
-        using difference_type   = std::ptrdiff_t;
-        using pointer           = value_type *;
-        using reference         = value_type &;
-
-        explicit constexpr const_iterator
-        (
-            BinaryArray const & array,
-            std::size_t const   index
-        ) :
-            array_{ array },
-            index_{ index }
-        {}
+        constexpr inline const_iterator operator+( difference_type const n ) const noexcept { auto copy{ *this }; return copy += n; }
+        constexpr inline const_iterator operator-( difference_type const n ) const noexcept { auto copy{ *this }; return copy -= n; }
 
-        inline bool operator==( const_iterator const & other ) const
+        constexpr inline difference_type operator-( const_iterator const & rhs ) const noexcept
         {
-            return index_ == other.index_ && &array_ == &other.array_;
+            return static_cast< difference_type >( index_ ) - static_cast< difference_type >( rhs.index_ );
         }
 
-        inline bool operator!=( const_iterator const & other ) const { return !( *this == other ); }
-
-        inline const_iterator & operator++() { ++index_; return *this; }
-
-        // Returning value_type should be OK since value_type is arithmetic.
-        inline value_type operator*() const { return array_[ index_ ]; }
+        constexpr inline bool operator==( const_iterator const & rhs ) const noexcept { return index_ == rhs.index_ && array_ == rhs.array_; }
+        constexpr inline bool operator!=( const_iterator const & rhs ) const noexcept { return !( *this == rhs ); }
+        constexpr inline bool operator< ( const_iterator const & rhs ) const noexcept { return index_ <  rhs.index_; }
+        constexpr inline bool operator> ( const_iterator const & rhs ) const noexcept { return index_ >  rhs.index_; }
+        constexpr inline bool operator<=( const_iterator const & rhs ) const noexcept { return index_ <= rhs.index_; }
+        constexpr inline bool operator>=( const_iterator const & rhs ) const noexcept { return index_ >= rhs.index_; }
 
     private:
-        BinaryArray const & array_;
-        std::size_t         index_;
+        BinaryArray const * array_{ nullptr };
+        std::size_t         index_{ 0       };
     };
 
-    constexpr inline auto       & data()       { return data_; }
+    using iterator = const_iterator;
+
+    // Genotype, chromosomeLength() bits per gene with the least significant bit
+    // first. Mutable access invalidates decoded values of a caching array, so
+    // the returned reference must not be written to after genes are read again.
+    constexpr inline auto & data()
+    {
+        if constexpr ( Cache )
+        {
+            cache_.valid = false;
+        }
+        return data_;
+    }
+
     constexpr inline auto const & data() const { return data_; }
 
+    constexpr inline auto chromosomeLength() const { return chromosomeLength_; }
+
     constexpr inline auto size() const { return N; }
 
     constexpr inline auto begin() const { return const_iterator( *this, 0 ); }
     constexpr inline auto end  () const { return const_iterator( *this, N ); }
 
-    constexpr inline auto begin() { return iterator( *this, 0 ); }
-    constexpr inline auto end  () { return iterator( *this, N ); }
-
 private:
+    struct Decoded
+    {
+        std::array< value_type, N > values{};
+        bool                        valid { false };
+    };
+
+    struct NotDecoded {};
+
+    constexpr inline value_type decodeGene( std::size_t const index ) const
+    {
+        return lowerBound_ + static_cast< value_type >( data_.bits( index * chromosomeLength_, chromosomeLength_ ) ) * scale_;
+    }
+
+    // Decodes all genes on first access after a write. A caching array must not
+    // be read by several threads at once before its genes are decoded.
+    constexpr inline std::array< value_type, N > const & decoded() const
+    {
+        if ( !cache_.valid )
+        {
+            for ( std::size_t i{ 0 }; i < N; ++i )
+            {
+                cache_.values[ i ] = decodeGene( i );
+            }
+            cache_.valid = true;
+        }
+        return cache_.values;
+    }
+
     value_type                  lowerBound_;
     value_type                  upperBound_;
     value_type                  boundWidth_;
     std::uint8_t                precision_;
     std::uint8_t                chromosomeLength_;
-    std::uint32_t               maxValue_;
-    std::vector< std::uint8_t > data_;
+    std::uint64_t               maxValue_;
+    value_type                  scale_;
+    BitVector                   data_;
+
+    mutable std::conditional_t< Cache, Decoded, NotDecoded > cache_;
 
 public:
     decimal_t fitness{ constant::worstFitness< decimal_t >() };
@@ -1,10 +1,13 @@
 #ifndef ECFCPP_CROSSOVERS_ARITHMETICAL_HPP
 #define ECFCPP_CROSSOVERS_ARITHMETICAL_HPP
 
+#include <ecfcpp/change_log.hpp>
 #include <ecfcpp/types.hpp>
 
 #include <cstddef>
 #include <iterator>
+#include <type_traits>
+#include <utility>
 
 namespace ecfcpp::crossover
 {
@@ -15,18 +18,49 @@ public:
     constexpr Arithmetical( float const lambda ) noexcept : lambda_{ lambda } {}
 
     template< typename T >
-    constexpr Container< T > operator()( T const & mom, T const & dad ) const
+    constexpr Container< individual_t< T > > operator()( T const & mom, T const & dad ) const
     {
-        T firstChild { mom };
-        T secondChild{ dad };
+        individual_t< T > firstChild { mom };
+        individual_t< T > secondChild{ dad };
 
+        ( *this )( mom, dad, firstChild, secondChild );
+
+        return { firstChild, secondChild };
+    }
+
+    // Children may be the parents themselves.
+    template< typename T, typename Child >
+    constexpr void operator()( T const & mom, T const & dad, Child && child ) const
+    {
+        ( *this )( mom, dad, std::forward< Child >( child ), NoChangeLog{} );
+    }
+
+    // Records genes it changes in child in log.
+    template< typename T, typename Child, typename Log, typename = std::enable_if_t< isChangeLog< Log > > >
+    constexpr void operator()( T const & mom, T const & dad, Child && child, Log && log ) const
+    {
         for ( std::size_t i{ 0 }; i < std::size( mom.data() ); ++i )
         {
-            firstChild .data()[ i ] = lambda_ * mom.data()[ i ] + ( 1 - lambda_ ) * dad.data()[ i ];
-            secondChild.data()[ i ] = lambda_ * dad.data()[ i ] + ( 1 - lambda_ ) * mom.data()[ i ];
+            log.write( child.data()[ i ], i, lambda_ * mom.data()[ i ] + ( 1 - lambda_ ) * dad.data()[ i ] );
         }
+    }
 
-        return { firstChild, secondChild };
+    template
+    <
+        typename T,
+        typename FirstChild,
+        typename SecondChild,
+        std::enable_if_t< !isChangeLog< SecondChild >, int > = 0
+    >
+    constexpr void operator()( T const & mom, T const & dad, FirstChild && firstChild, SecondChild && secondChild ) const
+    {
+        for ( std::size_t i{ 0 }; i < std::size( mom.data() ); ++i )
+        {
+            auto const x{ mom.data()[ i ] };
+            auto const y{ dad.data()[ i ] };
+            firstChild .data()[ i ] = lambda_ * x + ( 1 - lambda_ ) * y;
+            secondChild.data()[ i ] = lambda_ * y + ( 1 - lambda_ ) * x;
+        }
     }
 
 private:
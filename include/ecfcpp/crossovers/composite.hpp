@@ -1,50 +1,120 @@
 #ifndef ECFCPP_CROSSOVERS_COMPOSITE_HPP
 #define ECFCPP_CROSSOVERS_COMPOSITE_HPP
 
+#include <ecfcpp/adaptive.hpp>
+#include <ecfcpp/change_log.hpp>
+#include <ecfcpp/crossovers/in_place.hpp>
 #include <ecfcpp/types.hpp>
-#include <ecfcpp/utils/random.hpp>
+#include <ecfcpp/weighted.hpp>
 
 #include <cstddef>
-#include <functional>
-#include <initializer_list>
-#include <iterator>
-#include <vector>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace ecfcpp::crossover
 {
 
-template< typename T >
+// Applies one of its crossovers, chosen anew on every call with probability
+// proportional to its weight. Crossovers are given as they are or wrapped in
+// Weighted, as in Composite{ Uniform{}, Weighted{ BlxAlpha{ 0.2f }, 3 } }.
+// Given AdaptivePursuit first, weights only set the initial probabilities.
+template< typename... Crossovers >
 class Composite
 {
 public:
-    using Crossover = std::function< Container< T >( T const &, T const & ) >;
-
-    Composite
-    ( 
-        std::initializer_list< Crossover > const & crossovers
-    ) : 
-        chooseProbability_{ 1.0f / std::size( crossovers ) },
-        crossovers_{ crossovers }
+    static_assert( sizeof...( Crossovers ) > 0 );
+
+    template
+    <
+        typename... Args,
+        typename = std::enable_if_t< sizeof...( Args ) == sizeof...( Crossovers ) && ( !std::is_same_v< std::decay_t< Args >, Composite > && ... ) >
+    >
+    constexpr Composite( Args const &... crossovers ) :
+        crossovers_{ ecfcpp::detail::unweighted( crossovers )... },
+        choice_    { { { ecfcpp::detail::weightOf( crossovers )... } } }
+    {}
+
+    // Adapts probabilities of choosing crossovers to their success in the run.
+    template< typename... Args, typename = std::enable_if_t< sizeof...( Args ) == sizeof...( Crossovers ) > >
+    constexpr Composite( AdaptivePursuit const & pursuit, Args const &... crossovers ) :
+        crossovers_{ ecfcpp::detail::unweighted( crossovers )... },
+        choice_    { pursuit, { { ecfcpp::detail::weightOf( crossovers )... } } }
     {}
 
-    Container< T > operator()( T const & mom, T const & dad ) const
+    template< typename T >
+    constexpr Container< individual_t< T > > operator()( T const & mom, T const & dad ) const
+    {
+        return choose( [ & ]( auto const & crossover ) { return crossover( mom, dad ); } );
+    }
+
+    // Child may be one of the parents.
+    template< typename T, typename Child >
+    constexpr void operator()( T const & mom, T const & dad, Child && child ) const
     {
-        for ( auto const & crossover : crossovers_ )
-        {
-            if ( chooseProbability_ < random::uniform< decimal_t >() )
+        choose( [ & ]( auto const & crossover ) { inPlace( crossover, mom, dad, std::forward< Child >( child ) ); } );
+    }
+
+    // Records genes the chosen crossover changes in log, if it can.
+    template< typename T, typename Child, typename Log, typename = std::enable_if_t< isChangeLog< Log > > >
+    constexpr void operator()( T const & mom, T const & dad, Child && child, Log && log ) const
+    {
+        choose
+        (
+            [ & ]( auto const & crossover )
             {
-                return crossover( mom, dad );
+                inPlace( crossover, mom, dad, std::forward< Child >( child ), std::forward< Log >( log ) );
             }
-        }
+        );
+    }
+
+    // Index of a randomly chosen crossover. Engines choose and visit it themselves
+    // when they reward crossovers for offspring they make.
+    inline std::size_t choose() const noexcept { return choice_.choose(); }
+
+    // Calls function with crossover number choice.
+    template< typename Function >
+    constexpr decltype( auto ) visit( std::size_t const choice, Function && function ) const
+    {
+        return ecfcpp::detail::visit( crossovers_, choice, std::forward< Function >( function ) );
+    }
 
-        return crossovers_.back()( mom, dad );
+    // Rewards and adaptation change probabilities of future choices. Engines
+    // call them between generations, never while offspring is being bred.
+    inline void reward( std::size_t const choice, double const improvement ) const noexcept
+    {
+        choice_.reward( choice, improvement );
     }
 
+    inline void adapt() const noexcept { choice_.adapt(); }
+
+    // Restores the initial probabilities. Engines reset adaptive composites at
+    // the start of every run, so a composite used for several runs starts each
+    // of them afresh instead of from what earlier runs learned.
+    inline void reset() const noexcept { choice_.reset(); }
+
+    inline bool adaptive() const noexcept { return choice_.adaptive(); }
+
+    // Probability of choosing crossover number choice.
+    inline decimal_t probability( std::size_t const choice ) const noexcept { return choice_.probability( choice ); }
+
 private:
-    decimal_t chooseProbability_;
-    std::vector< Crossover > crossovers_;
+    template< typename Function >
+    constexpr decltype( auto ) choose( Function && function ) const
+    {
+        return visit( choose(), std::forward< Function >( function ) );
+    }
+
+    std::tuple< Crossovers... >                                       crossovers_;
+    mutable ecfcpp::detail::OperatorChoice< sizeof...( Crossovers ) > choice_;
 };
 
+template< typename... Args >
+Composite( Args... ) -> Composite< ecfcpp::detail::unweighted_t< Args >... >;
+
+template< typename... Args >
+Composite( AdaptivePursuit, Args... ) -> Composite< ecfcpp::detail::unweighted_t< Args >... >;
+
 }
 
 #endif // ECFCPP_CROSSOVERS_COMPOSITE_HPP
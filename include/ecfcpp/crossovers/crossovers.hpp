@@ -2,5 +2,6 @@
 #include "blx_alpha.hpp"
 #include "composite.hpp"
 #include "flat.hpp"
+#include "in_place.hpp"
 #include "single_point.hpp"
 #include "uniform.hpp"
\ No newline at end of file
@@ -1,12 +1,15 @@
 #ifndef ECFCPP_CROSSOVERS_FLAT_HPP
 #define ECFCPP_CROSSOVERS_FLAT_HPP
 
+#include <ecfcpp/change_log.hpp>
 #include <ecfcpp/types.hpp>
 #include <ecfcpp/utils/random.hpp>
 
 #include <algorithm>
 #include <cstddef>
 #include <iterator>
+#include <type_traits>
+#include <utility>
 
 namespace ecfcpp::crossover
 {
@@ -17,15 +20,33 @@ public:
     constexpr Flat() noexcept = default;
 
     template< typename T >
-    constexpr Container< T > operator()( T const & mom, T const & dad ) const
+    constexpr Container< individual_t< T > > operator()( T const & mom, T const & dad ) const
     {
-        T child{ mom };
-        for ( std::size_t i{ 0 }; i < std::size( child.data() ); ++i )
+        individual_t< T > child{ mom };
+        ( *this )( mom, dad, child );
+        return { child };
+    }
+
+    // Child may be one of the parents.
+    template< typename T, typename Child >
+    constexpr void operator()( T const & mom, T const & dad, Child && child ) const
+    {
+        ( *this )( mom, dad, std::forward< Child >( child ), NoChangeLog{} );
+    }
+
+    // Records genes it changes in child in log.
+    template< typename T, typename Child, typename Log, typename = std::enable_if_t< isChangeLog< Log > > >
+    constexpr void operator()( T const & mom, T const & dad, Child && child, Log && log ) const
+    {
+        auto const draws{ random::uniforms< decimal_t >( std::size( mom.data() ) ) };
+
+        for ( std::size_t i{ 0 }; i < std::size( mom.data() ); ++i )
         {
-            auto const [ min, max ] = std::minmax( mom.data()[ i ], dad.data()[ i ] );
-            child.data()[ i ] = random::uniform( min, max );
+            auto const x{ mom.data()[ i ] };
+            auto const y{ dad.data()[ i ] };
+            auto const [ min, max ] = std::minmax( x, y );
+            log.write( child.data()[ i ], i, min + draws[ i ] * ( max - min ) );
         }
-        return { child };
     }
 };
 
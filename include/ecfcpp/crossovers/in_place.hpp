@@ -0,0 +1,44 @@
+#ifndef ECFCPP_CROSSOVERS_IN_PLACE_HPP
+#define ECFCPP_CROSSOVERS_IN_PLACE_HPP
+
+#include <type_traits>
+#include <utility>
+
+namespace ecfcpp::crossover
+{
+
+// Writes the first child of mom and dad into child, which may be one of the
+// parents. Crossovers called as crossover( mom, dad, child ) write it directly,
+// others return their children which are then copied.
+template< typename Crossover, typename Parent, typename Child >
+constexpr void inPlace( Crossover const & crossover, Parent const & mom, Parent const & dad, Child && child )
+{
+    if constexpr ( std::is_invocable_v< Crossover const &, Parent const &, Parent const &, Child && > )
+    {
+        crossover( mom, dad, std::forward< Child >( child ) );
+    }
+    else
+    {
+        child = crossover( mom, dad )[ 0 ];
+    }
+}
+
+// Writes the first child of mom and dad into child, recording genes it changes
+// in log. Crossovers which cannot record them invalidate the log.
+template< typename Crossover, typename Parent, typename Child, typename Log >
+constexpr void inPlace( Crossover const & crossover, Parent const & mom, Parent const & dad, Child && child, Log && log )
+{
+    if constexpr ( std::is_invocable_v< Crossover const &, Parent const &, Parent const &, Child &&, Log && > )
+    {
+        crossover( mom, dad, std::forward< Child >( child ), std::forward< Log >( log ) );
+    }
+    else
+    {
+        log.invalidate();
+        inPlace( crossover, mom, dad, std::forward< Child >( child ) );
+    }
+}
+
+}
+
+#endif // ECFCPP_CROSSOVERS_IN_PLACE_HPP
@@ -1,12 +1,15 @@
 #ifndef ECFCPP_CROSSOVERS_SINGLE_POINT_HPP
 #define ECFCPP_CROSSOVERS_SINGLE_POINT_HPP
 
+#include <ecfcpp/change_log.hpp>
 #include <ecfcpp/types.hpp>
 #include <ecfcpp/utils/random.hpp>
 
 #include <algorithm>
 #include <cstddef>
 #include <iterator>
+#include <type_traits>
+#include <utility>
 
 namespace ecfcpp::crossover
 {
@@ -17,20 +20,53 @@ public:
     constexpr SinglePoint() noexcept = default;
 
     template< typename T >
-    constexpr Container< T > operator()( T const & mom, T const & dad ) const
+    constexpr Container< individual_t< T > > operator()( T const & mom, T const & dad ) const
     {
-        T firstChild { mom };
-        T secondChild{ dad };
+        individual_t< T > firstChild { mom };
+        individual_t< T > secondChild{ dad };
 
+        ( *this )( mom, dad, firstChild, secondChild );
+
+        return { firstChild, secondChild };
+    }
+
+    // Children may be the parents themselves.
+    template< typename T, typename Child >
+    constexpr void operator()( T const & mom, T const & dad, Child && child ) const
+    {
+        ( *this )( mom, dad, std::forward< Child >( child ), NoChangeLog{} );
+    }
+
+    // Records genes it changes in child in log.
+    template< typename T, typename Child, typename Log, typename = std::enable_if_t< isChangeLog< Log > > >
+    constexpr void operator()( T const & mom, T const & dad, Child && child, Log && log ) const
+    {
         auto const breakPoint{ random::uniform( 0UL, std::size( mom.data() ) ) };
 
-        for ( std::size_t i{ 0 }; i < breakPoint; ++i )
+        for ( std::size_t i{ 0 }; i < std::size( mom.data() ); ++i )
         {
-            firstChild .data()[ i ] = dad.data()[ i ];
-            secondChild.data()[ i ] = mom.data()[ i ];
+            log.write( child.data()[ i ], i, i < breakPoint ? dad.data()[ i ] : mom.data()[ i ] );
         }
+    }
 
-        return { firstChild, secondChild };
+    template
+    <
+        typename T,
+        typename FirstChild,
+        typename SecondChild,
+        std::enable_if_t< !isChangeLog< SecondChild >, int > = 0
+    >
+    constexpr void operator()( T const & mom, T const & dad, FirstChild && firstChild, SecondChild && secondChild ) const
+    {
+        auto const breakPoint{ random::uniform( 0UL, std::size( mom.data() ) ) };
+
+        for ( std::size_t i{ 0 }; i < std::size( mom.data() ); ++i )
+        {
+            auto const x{ mom.data()[ i ] };
+            auto const y{ dad.data()[ i ] };
+            firstChild .data()[ i ] = i < breakPoint ? y : x;
+            secondChild.data()[ i ] = i < breakPoint ? x : y;
+        }
     }
 };
 
@@ -1,11 +1,15 @@
 #ifndef ECFCPP_CROSSOVERS_UNIFORM_HPP
 #define ECFCPP_CROSSOVERS_UNIFORM_HPP
 
+#include <ecfcpp/change_log.hpp>
 #include <ecfcpp/types.hpp>
 #include <ecfcpp/utils/random.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <type_traits>
+#include <utility>
 
 namespace ecfcpp::crossover
 {
@@ -16,21 +20,56 @@ public:
     constexpr Uniform() noexcept = default;
 
     template< typename T >
-    constexpr Container< T > operator()( T const & mom, T const & dad ) const
+    constexpr Container< individual_t< T > > operator()( T const & mom, T const & dad ) const
     {
-        T firstChild { mom };
-        T secondChild{ dad };
+        individual_t< T > firstChild { mom };
+        individual_t< T > secondChild{ dad };
 
+        ( *this )( mom, dad, firstChild, secondChild );
+
+        return { firstChild, secondChild };
+    }
+
+    // Children may be the parents themselves.
+    template< typename T, typename Child >
+    constexpr void operator()( T const & mom, T const & dad, Child && child ) const
+    {
+        ( *this )( mom, dad, std::forward< Child >( child ), NoChangeLog{} );
+    }
+
+    // Records genes it changes in child in log.
+    template< typename T, typename Child, typename Log, typename = std::enable_if_t< isChangeLog< Log > > >
+    constexpr void operator()( T const & mom, T const & dad, Child && child, Log && log ) const
+    {
+        // Every gene takes one random bit.
+        std::uint64_t bits{ 0 };
         for ( std::size_t i{ 0 }; i < std::size( mom.data() ); ++i )
         {
-            if ( random::boolean() )
-            {
-                firstChild .data()[ i ] = dad.data()[ i ];
-                secondChild.data()[ i ] = mom.data()[ i ];
-            }
+            bits = i % 64 == 0 ? random::bits() : bits >> 1;
+            log.write( child.data()[ i ], i, ( bits & 1 ) != 0 ? dad.data()[ i ] : mom.data()[ i ] );
         }
+    }
 
-        return { firstChild, secondChild };
+    template
+    <
+        typename T,
+        typename FirstChild,
+        typename SecondChild,
+        std::enable_if_t< !isChangeLog< SecondChild >, int > = 0
+    >
+    constexpr void operator()( T const & mom, T const & dad, FirstChild && firstChild, SecondChild && secondChild ) const
+    {
+        std::uint64_t bits{ 0 };
+        for ( std::size_t i{ 0 }; i < std::size( mom.data() ); ++i )
+        {
+            bits = i % 64 == 0 ? random::bits() : bits >> 1;
+
+            auto const x{ mom.data()[ i ] };
+            auto const y{ dad.data()[ i ] };
+            auto const swap{ ( bits & 1 ) != 0 };
+            firstChild .data()[ i ] = swap ? y : x;
+            secondChild.data()[ i ] = swap ? x : y;
+        }
     }
 };
 
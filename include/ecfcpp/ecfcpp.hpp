@@ -4,15 +4,25 @@
 #include "chromosomes/chromosomes.hpp"
 #include "crossovers/crossovers.hpp"
 #include "factories/factories.hpp"
+#include "functions/batch.hpp"
 #include "functions/functions.hpp"
+#include "functions/memoized.hpp"
 #include "metaheuristics/metaheuristics.hpp"
 #include "mutations/mutations.hpp"
+#include "populations/populations.hpp"
 #include "problems/problems.hpp"
 #include "selections/selections.hpp"
 #include "utils/utils.hpp"
 
+#include "adaptive.hpp"
+#include "bit_vector.hpp"
 #include "bounded_array.hpp"
+#include "bounds.hpp"
+#include "change_log.hpp"
 #include "constants.hpp"
+#include "ranking.hpp"
+#include "span.hpp"
 #include "types.hpp"
+#include "weighted.hpp"
 
 #endif // ECFCPP_HPP
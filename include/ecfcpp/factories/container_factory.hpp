@@ -1,6 +1,7 @@
 #ifndef ECFCPP_FACTORIES_VECTOR_FACTORY_HPP
 #define ECFCPP_FACTORIES_VECTOR_FACTORY_HPP
 
+#include <ecfcpp/bounds.hpp>
 #include <ecfcpp/types.hpp>
 #include <ecfcpp/utils/random.hpp>
 
@@ -21,9 +22,10 @@ void initialize( Population & population, Function && initializer )
     (
         std::begin( population ),
         std::end  ( population ),
-        [ & initializer ]( auto & individual )
+        [ & initializer ]( auto && individual )
         {
             std::generate( std::begin( individual.data() ), std::end( individual.data() ), initializer );
+            bound::repair( individual );
         }
     );
 }
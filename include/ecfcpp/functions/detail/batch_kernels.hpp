@@ -0,0 +1,452 @@
+// Kernels of batch.hpp. This file has no include guard: batch.hpp includes it
+// once for every instruction set, inside a namespace which defines Pack< float >
+// and Pack< double > for that instruction set. Pack< T > provides:
+//
+//   Vector, Mask, width
+//   broadcast, load, store (aligned)
+//   add, sub, mul, div, fma( a, b, c ) = a * b + c, sqrt, abs, min, max
+//   round (to nearest), floor, greaterEqual, select( mask, ifTrue, ifFalse )
+//   pow2( n )     2^n for integral n in the normal exponent range
+//   exponent( x ) unbiased exponent of a positive normal x
+//   mantissa( x ) significand of a positive normal x, in [1, 2)
+
+template< typename T >
+using Vector = typename Pack< T >::Vector;
+
+template< typename T >
+struct Constants;
+
+template<>
+struct Constants< double >
+{
+    static constexpr double expMin{ -708.0 };
+    static constexpr double expMax{  709.0 };
+    static constexpr double log2e { 1.44269504088896340736 };
+    static constexpr double ln2Hi { 6.93147180369123816490e-01 };
+    static constexpr double ln2Lo { 1.90821492927058770002e-10 };
+    static constexpr double expCoefficients[]
+    {
+        1.0 / 6227020800.0, 1.0 / 479001600.0, 1.0 / 39916800.0, 1.0 / 3628800.0, 1.0 / 362880.0,
+        1.0 / 40320.0, 1.0 / 5040.0, 1.0 / 720.0, 1.0 / 120.0, 1.0 / 24.0, 1.0 / 6.0, 0.5, 1.0, 1.0
+    };
+
+    static constexpr double minNormal{ 2.2250738585072014e-308 };
+    static constexpr double sqrt2    { 1.41421356237309504880 };
+    static constexpr double logCoefficients[]
+    {
+        1.479819860511658591e-01, 1.531383769920937332e-01, 1.818357216161805012e-01,
+        2.222219843214978396e-01, 2.857142874366239149e-01, 3.999999999940941908e-01,
+        6.666666666666735130e-01
+    };
+
+    static constexpr double twoOverPi{ 0.63661977236758134308 };
+    static constexpr double piOver2[]{ 1.57079632673412561417e+00, 6.07710050630396597660e-11, 2.02226624871116645580e-21 };
+    static constexpr double sinCoefficients[]
+    {
+        1.58962301576546568060e-10, -2.50507477628578072866e-8, 2.75573136213857245213e-6,
+        -1.98412698295895385996e-4, 8.33333333332211858878e-3, -1.66666666666666307295e-1
+    };
+    static constexpr double cosCoefficients[]
+    {
+        -1.13585365213876817300e-11, 2.08757008419747316778e-9, -2.75573141792967388112e-7,
+        2.48015872888517045348e-5, -1.38888888888730564116e-3, 4.16666666666665929218e-2
+    };
+};
+
+template<>
+struct Constants< float >
+{
+    static constexpr float expMin{ -87.0f };
+    static constexpr float expMax{  88.0f };
+    static constexpr float log2e { 1.44269504088896341f };
+    static constexpr float ln2Hi { 0.693359375f };
+    static constexpr float ln2Lo { -2.12194440e-4f };
+    static constexpr float expCoefficients[]
+    {
+        1.0f / 5040.0f, 1.0f / 720.0f, 1.0f / 120.0f, 1.0f / 24.0f, 1.0f / 6.0f, 0.5f, 1.0f, 1.0f
+    };
+
+    static constexpr float minNormal{ 1.17549435e-38f };
+    static constexpr float sqrt2    { 1.41421356237309504880f };
+    static constexpr float logCoefficients[]
+    {
+        0.24279078841f, 0.28498786688f, 0.40000972152f, 0.66666662693f
+    };
+
+    static constexpr float twoOverPi{ 0.63661977236758134308f };
+    static constexpr float piOver2[]{ 1.5703125f, 4.837512969970703125e-4f, 7.54978995489188216e-8f };
+    static constexpr float sinCoefficients[]
+    {
+        -1.9515295891e-4f, 8.3321608736e-3f, -1.6666654611e-1f
+    };
+    static constexpr float cosCoefficients[]
+    {
+        2.443315711809948e-5f, -1.388731625493765e-3f, 4.166664568298827e-2f
+    };
+};
+
+template< typename T, std::size_t Size >
+inline Vector< T > polynomial( Vector< T > const x, T const ( & coefficients )[ Size ] )
+{
+    using P = Pack< T >;
+
+    auto result{ P::broadcast( coefficients[ 0 ] ) };
+    for ( std::size_t i{ 1 }; i < Size; ++i )
+    {
+        result = P::fma( result, x, P::broadcast( coefficients[ i ] ) );
+    }
+    return result;
+}
+
+template< typename T >
+inline Vector< T > vexp( Vector< T > x )
+{
+    using P = Pack< T >;
+    using C = Constants< T >;
+
+    x = P::min( P::max( x, P::broadcast( C::expMin ) ), P::broadcast( C::expMax ) );
+
+    auto const n{ P::round( P::mul( x, P::broadcast( C::log2e ) ) ) };
+    auto r{ P::fma( n, P::broadcast( -C::ln2Hi ), x ) };
+    r = P::fma( n, P::broadcast( -C::ln2Lo ), r );
+
+    return P::mul( polynomial( r, C::expCoefficients ), P::pow2( n ) );
+}
+
+template< typename T >
+inline Vector< T > vlog( Vector< T > x )
+{
+    using P = Pack< T >;
+    using C = Constants< T >;
+
+    x = P::max( x, P::broadcast( C::minNormal ) );
+
+    auto exponent{ P::exponent( x ) };
+    auto mantissa{ P::mantissa( x ) };
+
+    auto const large{ P::greaterEqual( mantissa, P::broadcast( C::sqrt2 ) ) };
+    mantissa = P::select( large, P::mul( mantissa, P::broadcast( T{ 0.5 } ) ), mantissa );
+    exponent = P::select( large, P::add( exponent, P::broadcast( T{ 1 } ) ), exponent );
+
+    auto const f   { P::sub( mantissa, P::broadcast( T{ 1 } ) ) };
+    auto const s   { P::div( f, P::add( f, P::broadcast( T{ 2 } ) ) ) };
+    auto const z   { P::mul( s, s ) };
+    auto const R   { P::mul( z, polynomial( z, C::logCoefficients ) ) };
+    auto const hfsq{ P::mul( P::broadcast( T{ 0.5 } ), P::mul( f, f ) ) };
+
+    // e * ln2Hi - ( ( hfsq - ( s * ( hfsq + R ) + e * ln2Lo ) ) - f )
+    auto const tail{ P::fma( exponent, P::broadcast( C::ln2Lo ), P::mul( s, P::add( hfsq, R ) ) ) };
+    return P::fma( exponent, P::broadcast( C::ln2Hi ), P::sub( f, P::sub( hfsq, tail ) ) );
+}
+
+template< typename T >
+inline void vsincos( Vector< T > const x, Vector< T > & sin, Vector< T > & cos )
+{
+    using P = Pack< T >;
+    using C = Constants< T >;
+
+    auto const q{ P::round( P::mul( x, P::broadcast( C::twoOverPi ) ) ) };
+
+    auto r{ P::fma( q, P::broadcast( -C::piOver2[ 0 ] ), x ) };
+    r = P::fma( q, P::broadcast( -C::piOver2[ 1 ] ), r );
+    r = P::fma( q, P::broadcast( -C::piOver2[ 2 ] ), r );
+
+    auto const z{ P::mul( r, r ) };
+    auto const s{ P::fma( P::mul( r, z ), polynomial( z, C::sinCoefficients ), r ) };
+    auto const c
+    {
+        P::fma
+        (
+            P::mul( z, z ),
+            polynomial( z, C::cosCoefficients ),
+            P::fma( P::broadcast( T{ -0.5 } ), z, P::broadcast( T{ 1 } ) )
+        )
+    };
+
+    // Quadrant of x, in [0, 4).
+    auto const quadrant{ P::sub( q, P::mul( P::broadcast( T{ 4 } ), P::floor( P::mul( q, P::broadcast( T{ 0.25 } ) ) ) ) ) };
+    auto const odd     { P::sub( quadrant, P::mul( P::broadcast( T{ 2 } ), P::floor( P::mul( quadrant, P::broadcast( T{ 0.5 } ) ) ) ) ) };
+    auto const swap    { P::greaterEqual( odd, P::broadcast( T{ 0.5 } ) ) };
+
+    auto const sinR{ P::select( swap, c, s ) };
+    auto const cosR{ P::select( swap, s, c ) };
+
+    auto const zero{ P::broadcast( T{ 0 } ) };
+    auto const two { P::broadcast( T{ 2 } ) };
+
+    auto shifted{ P::add( quadrant, P::broadcast( T{ 1 } ) ) };
+    shifted = P::select( P::greaterEqual( shifted, P::broadcast( T{ 4 } ) ), P::sub( shifted, P::broadcast( T{ 4 } ) ), shifted );
+
+    sin = P::select( P::greaterEqual( quadrant, two ), P::sub( zero, sinR ), sinR );
+    cos = P::select( P::greaterEqual( shifted,  two ), P::sub( zero, cosR ), cosR );
+}
+
+template< typename T >
+inline Vector< T > vsin( Vector< T > const x )
+{
+    Vector< T > sin, cos;
+    vsincos< T >( x, sin, cos );
+    return sin;
+}
+
+template< typename T >
+inline Vector< T > vcos( Vector< T > const x )
+{
+    Vector< T > sin, cos;
+    vsincos< T >( x, sin, cos );
+    return cos;
+}
+
+// Scores of Pack< T >::width consecutive individuals whose gene k is at genes[ k * stride ].
+
+template< typename T >
+inline Vector< T > score( Ackley const & kernel, T const * const genes, std::size_t const stride, std::size_t const n )
+{
+    using P = Pack< T >;
+
+    auto const c{ P::broadcast( static_cast< T >( kernel.c ) ) };
+
+    auto squares{ P::broadcast( T{ 0 } ) };
+    auto cosines{ P::broadcast( T{ 0 } ) };
+    for ( std::size_t k{ 0 }; k < n; ++k )
+    {
+        auto const x{ P::load( genes + k * stride ) };
+        squares = P::fma( x, x, squares );
+        cosines = P::add( cosines, vcos< T >( P::mul( c, x ) ) );
+    }
+
+    auto const inverseN{ P::broadcast( T{ 1 } / static_cast< T >( n ) ) };
+    auto const clause1{ P::mul( P::broadcast( static_cast< T >( -kernel.b ) ), P::sqrt( P::mul( squares, inverseN ) ) ) };
+    auto const clause2{ P::mul( cosines, inverseN ) };
+
+    return P::add
+    (
+        P::fma( P::broadcast( static_cast< T >( -kernel.a ) ), vexp< T >( clause1 ), P::sub( P::broadcast( T{ 0 } ), vexp< T >( clause2 ) ) ),
+        P::broadcast( static_cast< T >( kernel.a ) + constant::e< T >() )
+    );
+}
+
+template< typename T >
+inline Vector< T > score( AckleyN4 const &, T const * const genes, std::size_t const stride, std::size_t const n )
+{
+    using P = Pack< T >;
+
+    auto const e02  { P::broadcast( std::exp( static_cast< T >( -0.2 ) ) ) };
+    auto const two  { P::broadcast( T{ 2 } ) };
+    auto const three{ P::broadcast( T{ 3 } ) };
+
+    auto result{ P::broadcast( T{ 0 } ) };
+    for ( std::size_t k{ 0 }; k + 1 < n; ++k )
+    {
+        auto const x{ P::load( genes + k       * stride ) };
+        auto const y{ P::load( genes + ( k + 1 ) * stride ) };
+
+        auto const hypot{ P::sqrt( P::fma( x, x, P::mul( y, y ) ) ) };
+        auto const waves{ P::add( vcos< T >( P::mul( two, x ) ), vsin< T >( P::mul( two, y ) ) ) };
+        result = P::add( result, P::fma( e02, hypot, P::mul( three, waves ) ) );
+    }
+    return result;
+}
+
+template< typename T >
+inline Vector< T > score( AlpineN1 const &, T const * const genes, std::size_t const stride, std::size_t const n )
+{
+    using P = Pack< T >;
+
+    auto const tenth{ P::broadcast( static_cast< T >( 0.1 ) ) };
+
+    auto result{ P::broadcast( T{ 0 } ) };
+    for ( std::size_t k{ 0 }; k < n; ++k )
+    {
+        auto const x{ P::load( genes + k * stride ) };
+        result = P::add( result, P::abs( P::fma( x, vsin< T >( x ), P::mul( tenth, x ) ) ) );
+    }
+    return result;
+}
+
+template< typename T >
+inline Vector< T > score( AlpineN2 const &, T const * const genes, std::size_t const stride, std::size_t const n )
+{
+    using P = Pack< T >;
+
+    auto result{ P::broadcast( T{ 1 } ) };
+    for ( std::size_t k{ 0 }; k < n; ++k )
+    {
+        auto const x{ P::load( genes + k * stride ) };
+        result = P::mul( result, P::mul( P::sqrt( x ), vsin< T >( x ) ) );
+    }
+    return result;
+}
+
+template< typename T >
+inline Vector< T > score( Exponential const &, T const * const genes, std::size_t const stride, std::size_t const n )
+{
+    using P = Pack< T >;
+
+    auto squares{ P::broadcast( T{ 0 } ) };
+    for ( std::size_t k{ 0 }; k < n; ++k )
+    {
+        auto const x{ P::load( genes + k * stride ) };
+        squares = P::fma( x, x, squares );
+    }
+    return P::sub( P::broadcast( T{ 0 } ), vexp< T >( P::mul( P::broadcast( T{ -0.5 } ), squares ) ) );
+}
+
+template< typename T >
+inline Vector< T > score( Griewank const &, T const * const genes, std::size_t const stride, std::size_t const n )
+{
+    using P = Pack< T >;
+
+    auto squares{ P::broadcast( T{ 0 } ) };
+    auto cosines{ P::broadcast( T{ 1 } ) };
+    for ( std::size_t k{ 0 }; k < n; ++k )
+    {
+        auto const x{ P::load( genes + k * stride ) };
+        squares = P::fma( x, x, squares );
+        cosines = P::mul( cosines, vcos< T >( P::mul( x, P::broadcast( T{ 1 } / std::sqrt( static_cast< T >( k + 1 ) ) ) ) ) );
+    }
+    return P::sub( P::fma( squares, P::broadcast( T{ 1 } / 4000 ), P::broadcast( T{ 1 } ) ), cosines );
+}
+
+template< typename T >
+inline Vector< T > score( Rastrigin const &, T const * const genes, std::size_t const stride, std::size_t const n )
+{
+    using P = Pack< T >;
+
+    auto const tau{ P::broadcast( constant::tau< T >() ) };
+    auto const ten{ P::broadcast( T{ -10 } ) };
+
+    auto result{ P::broadcast( static_cast< T >( 10 * n ) ) };
+    for ( std::size_t k{ 0 }; k < n; ++k )
+    {
+        auto const x{ P::load( genes + k * stride ) };
+        result = P::add( result, P::fma( ten, vcos< T >( P::mul( tau, x ) ), P::mul( x, x ) ) );
+    }
+    return result;
+}
+
+template< typename T >
+inline Vector< T > score( Rosenbrock const & kernel, T const * const genes, std::size_t const stride, std::size_t const n )
+{
+    using P = Pack< T >;
+
+    auto const a{ P::broadcast( static_cast< T >( kernel.a ) ) };
+    auto const b{ P::broadcast( static_cast< T >( kernel.b ) ) };
+
+    auto result{ P::broadcast( T{ 0 } ) };
+    for ( std::size_t k{ 0 }; k + 1 < n; ++k )
+    {
+        auto const x{ P::load( genes + k       * stride ) };
+        auto const y{ P::load( genes + ( k + 1 ) * stride ) };
+
+        auto const valley{ P::sub( y, P::mul( x, x ) ) };
+        auto const slope { P::sub( a, x ) };
+        result = P::add( result, P::fma( P::mul( b, valley ), valley, P::mul( slope, slope ) ) );
+    }
+    return result;
+}
+
+template< typename T >
+inline Vector< T > score( ShafferF6 const &, T const * const genes, std::size_t const stride, std::size_t const n )
+{
+    using P = Pack< T >;
+
+    auto sum{ P::broadcast( T{ 0 } ) };
+    for ( std::size_t k{ 0 }; k < n; ++k )
+    {
+        auto const x{ P::load( genes + k * stride ) };
+        sum = P::fma( x, x, sum );
+    }
+
+    auto const half       { P::broadcast( T{ 0.5 } ) };
+    auto const numerator  { vsin< T >( P::sqrt( sum ) ) };
+    auto const denominator{ P::fma( P::broadcast( static_cast< T >( 0.001 ) ), sum, P::broadcast( T{ 1 } ) ) };
+
+    return P::add
+    (
+        half,
+        P::div( P::fma( numerator, numerator, P::sub( P::broadcast( T{ 0 } ), half ) ), P::mul( denominator, denominator ) )
+    );
+}
+
+template< typename T >
+inline Vector< T > score( ShafferF7 const &, T const * const genes, std::size_t const stride, std::size_t const n )
+{
+    using P = Pack< T >;
+
+    auto const normalizer{ P::broadcast( 1 / static_cast< T >( n - 1 ) ) };
+    auto const fifth     { P::broadcast( static_cast< T >( 0.2 ) ) };
+    auto const fifty     { P::broadcast( T{ 50 } ) };
+    auto const one       { P::broadcast( T{ 1 } ) };
+
+    auto result{ P::broadcast( T{ 0 } ) };
+    for ( std::size_t k{ 0 }; k + 1 < n; ++k )
+    {
+        auto const x{ P::load( genes + k       * stride ) };
+        auto const y{ P::load( genes + ( k + 1 ) * stride ) };
+
+        auto const si    { P::sqrt( P::fma( x, x, P::mul( y, y ) ) ) };
+        auto const power { vexp< T >( P::mul( fifth, vlog< T >( si ) ) ) };
+        auto const factor{ P::mul( P::mul( normalizer, P::sqrt( si ) ), P::add( vsin< T >( P::mul( fifty, power ) ), one ) ) };
+        result = P::fma( factor, factor, result );
+    }
+    return result;
+}
+
+template< typename T >
+inline Vector< T > score( Sphere const &, T const * const genes, std::size_t const stride, std::size_t const n )
+{
+    using P = Pack< T >;
+
+    auto result{ P::broadcast( T{ 0 } ) };
+    for ( std::size_t k{ 0 }; k < n; ++k )
+    {
+        auto const x{ P::load( genes + k * stride ) };
+        result = P::fma( x, x, result );
+    }
+    return result;
+}
+
+template< typename T >
+inline Vector< T > score( OffsetSphere const &, T const * const genes, std::size_t const stride, std::size_t const n )
+{
+    using P = Pack< T >;
+
+    auto result{ P::broadcast( T{ 0 } ) };
+    for ( std::size_t k{ 0 }; k < n; ++k )
+    {
+        auto const x{ P::sub( P::load( genes + k * stride ), P::broadcast( static_cast< T >( k + 1 ) ) ) };
+        result = P::fma( x, x, result );
+    }
+    return result;
+}
+
+// Scores individuals [begin, end) of a population whose gene rows start at genes.
+// Lanes are processed in whole vectors starting at a multiple of the vector
+// width; rows are padded to a cache line, so vectors never leave a row.
+template< typename Kernel, typename T, typename Decimal >
+inline void run
+(
+    Kernel      const &       kernel,
+    T           const * const genes,
+    std::size_t const         stride,
+    std::size_t const         n,
+    std::size_t const         begin,
+    std::size_t const         end,
+    Decimal           * const out
+)
+{
+    using P = Pack< T >;
+
+    for ( std::size_t first{ begin / P::width * P::width }; first < end; first += P::width )
+    {
+        alignas( 64 ) T lanes[ P::width ];
+        P::store( lanes, score( kernel, genes + first, stride, n ) );
+
+        auto const last{ std::min( first + P::width, end ) };
+        for ( std::size_t i{ std::max( first, begin ) }; i < last; ++i )
+        {
+            out[ i ] = static_cast< Decimal >( lanes[ i - first ] );
+        }
+    }
+}
@@ -4,10 +4,14 @@
 #include <ecfcpp/constants.hpp>
 #include <ecfcpp/types.hpp>
 
+#include <atomic>
+#include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <iterator>
 #include <type_traits>
+#include <utility>
 
 namespace ecfcpp::function
 {
@@ -18,23 +22,81 @@ class CallCounter
 public:
     constexpr CallCounter( Function function ) : function_{ function } {}
 
-    constexpr CallCounter( CallCounter const & other ) = default;
-    constexpr CallCounter( CallCounter && other ) = default;
+    // Counter is atomic so that populations can be evaluated in parallel.
+    constexpr CallCounter( CallCounter const & other ) :
+        function_    { other.function_     },
+        callCounter_ { other.callCount()   },
+        deltaCounter_{ other.deltaCount()  }
+    {}
+
+    constexpr CallCounter( CallCounter && other ) :
+        function_    { std::move( other.function_ ) },
+        callCounter_ { other.callCount()            },
+        deltaCounter_{ other.deltaCount()           }
+    {}
 
     template< typename Point >
     [[ nodiscard ]] constexpr auto operator()( Point const & p ) const noexcept
     {
-        ++callCounter_;
+        callCounter_.fetch_add( 1, std::memory_order_relaxed );
         return function_( p );
     }
 
-    constexpr inline auto callCount() const noexcept { return callCounter_; }
+    // Batch call, counted once for every scored individual.
+    template< typename Population, typename = std::enable_if_t< isBatchFunction< Function, Population > > >
+    constexpr void operator()
+    (
+        Population                     const &       population,
+        std::size_t                    const         begin,
+        std::size_t                    const         end,
+        typename Population::decimal_t       * const out
+    ) const
+    {
+        callCounter_.fetch_add( end - begin, std::memory_order_relaxed );
+        function_( population, begin, end, out );
+    }
+
+    // Delta call, see ChangeLog. Counted apart from full evaluations.
+    template
+    <
+        typename Point,
+        typename Changes,
+        typename F = Function,
+        typename   = decltype( std::declval< F const & >().delta( std::declval< Point const & >(), std::declval< Changes const & >() ) )
+    >
+    [[ nodiscard ]] constexpr auto delta( Point const & point, Changes const & changes ) const
+    {
+        deltaCounter_.fetch_add( 1, std::memory_order_relaxed );
+        return function_.delta( point, changes );
+    }
+
+    constexpr inline auto callCount () const noexcept { return callCounter_ .load( std::memory_order_relaxed ); }
+    constexpr inline auto deltaCount() const noexcept { return deltaCounter_.load( std::memory_order_relaxed ); }
 
 private:
     Function function_;
-    mutable std::uint64_t callCounter_{};
+    mutable std::atomic< std::uint64_t > callCounter_{};
+    mutable std::atomic< std::uint64_t > deltaCounter_{};
 };
 
+namespace detail
+{
+
+// Score of point minus its score before changes, see ChangeLog, for functions
+// which add up term( gene ) over all genes.
+template< typename Decimal, typename Point, typename Changes, typename Term >
+constexpr Decimal sumDelta( Point const & point, Changes const & changes, Term const & term ) noexcept
+{
+    Decimal result{ 0 };
+    for ( auto const & change : changes )
+    {
+        result += term( static_cast< Decimal >( point[ change.index ] ) ) - term( static_cast< Decimal >( change.previous ) );
+    }
+    return result;
+}
+
+}
+
 // http://benchmarkfcns.xyz/benchmarkfcns/ackleyfcn.html
 template
 <
@@ -87,22 +149,36 @@ template
 }
 
 // http://benchmarkfcns.xyz/benchmarkfcns/alpinen1fcn.html
+// Also updates scores of points from their changes, see ChangeLog.
+template< typename Point, typename Decimal >
+struct AlpineN1
+{
+    static constexpr Decimal term( Decimal const v ) noexcept { return std::abs( v * std::sin( v ) + 0.1 * v ); }
+
+    [[ nodiscard ]] constexpr Decimal operator()( Point const & p ) const noexcept
+    {
+        Decimal result{ 0 };
+        for ( auto const & x : p )
+        {
+            result += term( static_cast< Decimal >( x ) );
+        }
+        return result;
+    }
+
+    template< typename Changes >
+    [[ nodiscard ]] constexpr Decimal delta( Point const & p, Changes const & changes ) const noexcept
+    {
+        return detail::sumDelta< Decimal >( p, changes, term );
+    }
+};
+
 template
 <
     typename Point,
     typename Decimal = std::conditional_t< std::is_floating_point_v< typename Point::value_type >, typename Point::value_type, decimal_t >,
     typename = std::enable_if_t< std::is_arithmetic_v< typename Point::value_type > >
 >
-[[ nodiscard ]] constexpr Decimal alpinen1( Point const & p ) noexcept
-{
-    Decimal result{ 0 };
-    for ( auto const & x : p )
-    {
-        auto const v{ static_cast< Decimal >( x ) };
-        result += std::abs( v * std::sin( v ) + 0.1 * v );
-    }
-    return result;
-}
+constexpr inline AlpineN1< Point, Decimal > alpinen1{};
 
 
 // http://benchmarkfcns.xyz/benchmarkfcns/alpinen2fcn.html
@@ -159,9 +235,7 @@ template
         auto const v{ static_cast< Decimal >( x ) };
 
         clause1 += v * v;
-        clause2 *= std::cos( v / std::sqrt( static_cast< Decimal >( i ) ) );
-
-        ++i;
+        clause2 *= std::cos( v / std::sqrt( static_cast< Decimal >( ++i ) ) );
     }
 
     clause1 /= 4000;
@@ -170,22 +244,36 @@ template
 }
 
 // http://benchmarkfcns.xyz/benchmarkfcns/rastriginfcn.html
+// Also updates scores of points from their changes, see ChangeLog.
+template< typename Point, typename Decimal >
+struct Rastrigin
+{
+    static constexpr Decimal term( Decimal const v ) noexcept { return v * v - 10 * std::cos( constant::tau< Decimal >() * v ); }
+
+    [[ nodiscard ]] constexpr Decimal operator()( Point const & point ) const noexcept
+    {
+        Decimal result{ static_cast< Decimal >( 10 * std::size( point ) ) };
+        for ( auto const & x : point )
+        {
+            result += term( static_cast< Decimal >( x ) );
+        }
+        return result;
+    }
+
+    template< typename Changes >
+    [[ nodiscard ]] constexpr Decimal delta( Point const & point, Changes const & changes ) const noexcept
+    {
+        return detail::sumDelta< Decimal >( point, changes, term );
+    }
+};
+
 template
 <
     typename Point,
     typename Decimal = std::conditional_t< std::is_floating_point_v< typename Point::value_type >, typename Point::value_type, decimal_t >,
     typename = std::enable_if_t< std::is_arithmetic_v< typename Point::value_type > >
 >
-[[ nodiscard ]] constexpr Decimal rastrigin( Point const & point ) noexcept
-{
-    Decimal result{ 10 * std::size( point ) };
-    for ( auto const & x : point )
-    {
-        auto const v{ static_cast< Decimal >( x ) };
-        result += v * v - 10 * std::cos( constant::tau< Decimal >() * v );
-    }
-    return result;
-}
+constexpr inline Rastrigin< Point, Decimal > rastrigin{};
 
 // http://benchmarkfcns.xyz/benchmarkfcns/rosenbrockfcn.html
 template
@@ -258,22 +346,36 @@ template
 }
 
 // https://www.sfu.ca/~ssurjano/spheref.html
+// Also updates scores of points from their changes, see ChangeLog.
+template< typename Point, typename Decimal >
+struct Sphere
+{
+    static constexpr Decimal term( Decimal const v ) noexcept { return v * v; }
+
+    [[ nodiscard ]] constexpr Decimal operator()( Point const & point ) const noexcept
+    {
+        Decimal result{ 0 };
+        for ( auto const & x : point )
+        {
+            result += term( static_cast< Decimal >( x ) );
+        }
+        return result;
+    }
+
+    template< typename Changes >
+    [[ nodiscard ]] constexpr Decimal delta( Point const & point, Changes const & changes ) const noexcept
+    {
+        return detail::sumDelta< Decimal >( point, changes, term );
+    }
+};
+
 template
 <
     typename Point,
     typename Decimal = std::conditional_t< std::is_floating_point_v< typename Point::value_type >, typename Point::value_type, decimal_t >,
     typename = std::enable_if_t< std::is_arithmetic_v< typename Point::value_type > >
 >
-[[ nodiscard ]] constexpr Decimal sphere( Point const & point ) noexcept
-{
-    Decimal result{ 0 };
-    for ( auto const & x : point )
-    {
-        auto const v{ static_cast< Decimal >( x ) };
-        result += v * v;
-    }
-    return result;
-}
+constexpr inline Sphere< Point, Decimal > sphere{};
 
 template
 <
@@ -0,0 +1,332 @@
+#ifndef ECFCPP_FUNCTIONS_MEMOIZED_HPP
+#define ECFCPP_FUNCTIONS_MEMOIZED_HPP
+
+#include <ecfcpp/bit_vector.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ecfcpp::function
+{
+
+namespace detail
+{
+
+inline std::uint64_t mix( std::uint64_t x ) noexcept
+{
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EB;
+    x ^= x >> 31;
+    return x;
+}
+
+template< typename Point, typename = void >
+struct HasBitGenotype : std::false_type {};
+
+template< typename Point >
+struct HasBitGenotype< Point, std::void_t< decltype( std::declval< Point const & >().data() ) > > :
+    std::is_same< std::decay_t< decltype( std::declval< Point const & >().data() ) >, BitVector >
+{};
+
+// Calls visit( word ) for the words holding the exact bits of point, in order,
+// until it returns false. Returns whether it never did. Binary genotypes are
+// their packed words followed by their size, others the bits of every gene.
+// Equal genes with different representations, e.g. 0.0 and -0.0, differ.
+template< typename Point, typename Visit >
+bool visitGenotype( Point const & point, Visit && visit )
+{
+    if constexpr ( HasBitGenotype< Point >::value )
+    {
+        auto const & bits{ point.data() };
+        for ( std::size_t i{ 0 }; i < bits.wordCount(); ++i )
+        {
+            if ( !visit( std::uint64_t{ bits.words()[ i ] } ) )
+            {
+                return false;
+            }
+        }
+        return visit( std::uint64_t{ bits.size() } );
+    }
+    else
+    {
+        for ( auto const gene : point )
+        {
+            static_assert( sizeof( gene ) <= sizeof( std::uint64_t ) );
+
+            std::uint64_t word{ 0 };
+            std::memcpy( &word, &gene, sizeof( gene ) );
+            if ( !visit( word ) )
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+template< typename Point >
+std::size_t genotypeHash( Point const & point )
+{
+    std::uint64_t hash { 0 };
+    std::size_t   count{ 0 };
+    visitGenotype( point, [ & ]( std::uint64_t const word ){ hash = mix( hash ^ word ); ++count; return true; } );
+    return mix( hash ^ count );
+}
+
+// Whether words hold the exact bits of point.
+template< typename Point >
+bool sameGenotype( std::vector< std::uint64_t > const & words, Point const & point )
+{
+    std::size_t i{ 0 };
+    auto const prefix
+    {
+        visitGenotype( point, [ & ]( std::uint64_t const word ){ return i < std::size( words ) && words[ i++ ] == word; } )
+    };
+    return prefix && i == std::size( words );
+}
+
+// Bounded map from genotypes to scores, evicting with the CLOCK algorithm.
+// Genotypes are looked up by their hash and compared in place, so only
+// inserting one copies its words.
+template< typename Value >
+class MemoShard
+{
+public:
+    explicit MemoShard( std::size_t const capacity ) : capacity_{ capacity }
+    {
+        slots_.reserve( capacity_ );
+        index_.reserve( capacity_ );
+    }
+
+    template< typename Point >
+    std::optional< Value > find( std::size_t const hash, Point const & point )
+    {
+        std::lock_guard< std::mutex > const lock{ mutex_ };
+
+        auto const position{ locate( hash, point ) };
+        if ( position == none )
+        {
+            return std::nullopt;
+        }
+
+        auto & slot{ slots_[ position ] };
+        slot.referenced = true;
+        return slot.value;
+    }
+
+    template< typename Point >
+    void insert( std::size_t const hash, Point const & point, Value const value )
+    {
+        std::lock_guard< std::mutex > const lock{ mutex_ };
+
+        if ( locate( hash, point ) != none )
+        {
+            return;
+        }
+
+        std::size_t position;
+        if ( std::size( slots_ ) < capacity_ )
+        {
+            position = std::size( slots_ );
+            slots_.emplace_back();
+        }
+        else
+        {
+            while ( slots_[ hand_ ].referenced )
+            {
+                slots_[ hand_ ].referenced = false;
+                hand_ = ( hand_ + 1 ) % capacity_;
+            }
+            position = hand_;
+            hand_ = ( hand_ + 1 ) % capacity_;
+
+            auto const [ begin, end ]{ index_.equal_range( slots_[ position ].hash ) };
+            index_.erase( std::find_if( begin, end, [ position ]( auto const & entry ){ return entry.second == position; } ) );
+        }
+
+        // Words of an evicted genotype keep their storage for the new one.
+        auto & slot{ slots_[ position ] };
+        slot.words.clear();
+        visitGenotype( point, [ & slot ]( std::uint64_t const word ){ slot.words.push_back( word ); return true; } );
+        slot.hash       = hash;
+        slot.value      = value;
+        slot.referenced = true;
+
+        index_.emplace( hash, position );
+    }
+
+    std::size_t size()
+    {
+        std::lock_guard< std::mutex > const lock{ mutex_ };
+        return std::size( index_ );
+    }
+
+    void clear()
+    {
+        std::lock_guard< std::mutex > const lock{ mutex_ };
+        index_.clear();
+        slots_.clear();
+        hand_ = 0;
+    }
+
+private:
+    static constexpr std::size_t none{ std::numeric_limits< std::size_t >::max() };
+
+    struct Slot
+    {
+        std::vector< std::uint64_t > words;
+        std::size_t                  hash      { 0     };
+        Value                        value     {       };
+        bool                         referenced{ false };
+    };
+
+    // Position of the slot holding point, or none.
+    template< typename Point >
+    std::size_t locate( std::size_t const hash, Point const & point ) const
+    {
+        auto const [ begin, end ]{ index_.equal_range( hash ) };
+        for ( auto it{ begin }; it != end; ++it )
+        {
+            if ( sameGenotype( slots_[ it->second ].words, point ) )
+            {
+                return it->second;
+            }
+        }
+        return none;
+    }
+
+    std::mutex  mutex_;
+    std::size_t capacity_;
+    std::size_t hand_{ 0 };
+
+    std::vector< Slot >                                  slots_;
+    std::unordered_multimap< std::size_t, std::size_t > index_;
+};
+
+}
+
+// Remembers scores of the most recently used genotypes, up to capacity of
+// them in total, so that repeated genotypes are not evaluated again. The cache is split
+// into independently locked shards and is shared by all copies of a Memoized,
+// so it can be used from several threads. The function runs outside of locks;
+// when two threads miss on the same genotype, both evaluate it. To count real
+// evaluations wrap function in a CallCounter and read it through function();
+// to count all calls wrap Memoized in a CallCounter.
+template< typename Function, typename Value = double >
+class Memoized
+{
+public:
+    explicit Memoized
+    (
+        Function    const function,
+        std::size_t const capacity   = 1 << 16,
+        std::size_t const shardCount = 16
+    ) :
+        function_{ function                                      },
+        state_   { std::make_shared< State >( capacity, shardCount ) }
+    {}
+
+    template< typename Point >
+    [[ nodiscard ]] Value operator()( Point const & point ) const
+    {
+        auto const hash{ detail::genotypeHash( point ) };
+        auto &     shard{ state_->shard( hash ) };
+
+        if ( auto const value{ shard.find( hash, point ) } )
+        {
+            state_->hits.fetch_add( 1, std::memory_order_relaxed );
+            return *value;
+        }
+
+        state_->misses.fetch_add( 1, std::memory_order_relaxed );
+
+        Value const value( function_( point ) );
+        shard.insert( hash, point, value );
+        return value;
+    }
+
+    inline Function const & function() const noexcept { return function_; }
+
+    inline auto hitCount () const noexcept { return state_->hits  .load( std::memory_order_relaxed ); }
+    inline auto missCount() const noexcept { return state_->misses.load( std::memory_order_relaxed ); }
+
+    // Number of cached genotypes.
+    std::size_t size() const
+    {
+        std::size_t result{ 0 };
+        for ( auto & shard : state_->shards )
+        {
+            result += shard->size();
+        }
+        return result;
+    }
+
+    void clear() const
+    {
+        for ( auto & shard : state_->shards )
+        {
+            shard->clear();
+        }
+    }
+
+private:
+    struct State
+    {
+        State( std::size_t const capacity, std::size_t const shardCount )
+        {
+            // Every shard holds at least one genotype, so there are no more
+            // shards than capacity allows.
+            auto const limit{ std::max< std::size_t >( std::min( shardCount, capacity ), 1 ) };
+
+            std::size_t count{ 1 };
+            while ( count < limit )
+            {
+                count *= 2;
+            }
+            if ( count > std::max< std::size_t >( capacity, 1 ) )
+            {
+                count /= 2;
+            }
+
+            // Capacity is split so that shards hold capacity genotypes together.
+            shards.reserve( count );
+            for ( std::size_t i{ 0 }; i < count; ++i )
+            {
+                auto const shardCapacity{ std::max< std::size_t >( capacity / count + ( i < capacity % count ? 1 : 0 ), 1 ) };
+                shards.push_back( std::make_unique< detail::MemoShard< Value > >( shardCapacity ) );
+            }
+        }
+
+        // Upper bits pick the shard, lower bits the bucket inside it.
+        inline detail::MemoShard< Value > & shard( std::size_t const hash )
+        {
+            return *shards[ ( hash >> std::numeric_limits< std::size_t >::digits / 2 ) & ( std::size( shards ) - 1 ) ];
+        }
+
+        std::vector< std::unique_ptr< detail::MemoShard< Value > > > shards;
+
+        std::atomic< std::uint64_t > hits  { 0 };
+        std::atomic< std::uint64_t > misses{ 0 };
+    };
+
+    Function                 function_;
+    std::shared_ptr< State > state_;
+};
+
+}
+
+#endif // ECFCPP_FUNCTIONS_MEMOIZED_HPP
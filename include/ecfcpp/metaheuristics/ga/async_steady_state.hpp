@@ -0,0 +1,263 @@
+#ifndef ECFCPP_METAHEURISTICS_GA_ASYNC_STEADY_STATE_HPP
+#define ECFCPP_METAHEURISTICS_GA_ASYNC_STEADY_STATE_HPP
+
+#include <ecfcpp/bounds.hpp>
+#include <ecfcpp/metaheuristics/ga/breed.hpp>
+#include <ecfcpp/metaheuristics/ga/credit.hpp>
+#include <ecfcpp/metaheuristics/ga/observer.hpp>
+#include <ecfcpp/utils/random.hpp>
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ecfcpp::ga
+{
+
+// Policies choosing which individual of population an evaluated offspring
+// replaces, called as replacement( population, offspring ). They return the
+// index of the victim, or nothing if offspring is discarded.
+namespace replacement
+{
+
+// Replaces a random individual.
+struct Random
+{
+    template< typename Population, typename Individual >
+    std::optional< std::size_t > operator()( Population const & population, Individual const & ) const
+    {
+        return random::uniform< std::size_t >( 0, std::size( population ) );
+    }
+};
+
+// Replaces the worst individual, unless offspring is worse still. Takes time
+// proportional to the size of population.
+struct Worst
+{
+    template< typename Population, typename Individual >
+    std::optional< std::size_t > operator()( Population const & population, Individual const & offspring ) const
+    {
+        std::size_t worst{ 0 };
+        for ( std::size_t i{ 1 }; i < std::size( population ); ++i )
+        {
+            if ( population[ i ].fitness < population[ worst ].fitness )
+            {
+                worst = i;
+            }
+        }
+
+        return offspring.fitness >= population[ worst ].fitness ? std::optional< std::size_t >{ worst } : std::nullopt;
+    }
+};
+
+// Replaces the worst of size randomly picked individuals, unless offspring is
+// worse still.
+struct Tournament
+{
+    std::size_t size{ 3 };
+
+    template< typename Population, typename Individual >
+    std::optional< std::size_t > operator()( Population const & population, Individual const & offspring ) const
+    {
+        assert( size > 0 );
+
+        auto const pick{ [ & ](){ return random::uniform< std::size_t >( 0, std::size( population ) ); } };
+
+        auto worst{ pick() };
+        for ( std::size_t i{ 1 }; i < size; ++i )
+        {
+            auto const candidate{ pick() };
+            if ( population[ candidate ].fitness < population[ worst ].fitness )
+            {
+                worst = candidate;
+            }
+        }
+
+        return offspring.fitness >= population[ worst ].fitness ? std::optional< std::size_t >{ worst } : std::nullopt;
+    }
+};
+
+}
+
+namespace detail
+{
+
+template< typename Population >
+std::size_t bestIndex( Population const & population )
+{
+    std::size_t best{ 0 };
+    for ( std::size_t i{ 1 }; i < std::size( population ); ++i )
+    {
+        if ( population[ i ].fitness > population[ best ].fitness )
+        {
+            best = i;
+        }
+    }
+    return best;
+}
+
+}
+
+// Steady-state algorithm without generations. Each of threadCount threads
+// breeds an offspring of parents selected from the population, evaluates it
+// and immediately puts it in place of the victim replacement chooses, then
+// breeds the next one, so threads never wait for evaluations of the others.
+// Breeding and replacement hold a lock on the population, evaluation does not,
+// so the engine pays off when evaluation dominates, especially if its time
+// varies. Selections are used without preparing them, so ones which do their
+// work once per generation, such as RouletteWheel, do it for every parent;
+// Tournament does not. Adaptive operators adapt after every size of population
+// offspring. Run stops after maxEvaluations offspring or once the best
+// individual reaches desired fitness. Threads interleave in no fixed order, so
+// the result of a run is not reproducible even for a fixed seed. Problem must
+// be safe to call concurrently.
+template
+<
+    typename Problem,
+    typename Selection,
+    typename Crossover,
+    typename Mutation,
+    typename Population,
+    typename Replacement = replacement::Random
+>
+[[ nodiscard ]] auto async_steady_state
+(
+    std::size_t const   threadCount,
+    std::size_t const   maxEvaluations,
+    double      const   desiredFitness,
+    double      const   precision,
+    Problem     const & problem,
+    Selection   const & selection,
+    Crossover   const & crossover,
+    Mutation    const & mutation,
+    Population  const & initialPopulation,
+    Replacement const & replacement = {}
+)
+{
+    assert( threadCount > 0 );
+    assert( !std::empty( initialPopulation ) );
+
+    using Individual = typename Population::value_type;
+
+    constexpr bool adaptive{ detail::isAdaptive< Crossover > || detail::isAdaptive< Mutation > };
+
+    auto population{ initialPopulation };
+    problem.evaluate( population );
+    detail::reset( crossover, mutation );
+
+    auto               best    { detail::bestIndex( population )                                         };
+    auto               solved  { std::abs( population[ best ].fitness - desiredFitness ) <= precision };
+    std::size_t        started { 0                                                                       };
+    std::size_t        rewarded{ 0                                                                       };
+    std::mutex         mutex;
+    std::exception_ptr exception;
+
+    auto const seed{ random::stream().nextSeed() };
+
+    auto const evolve
+    {
+        [ & ]( std::size_t const self )
+        {
+            random::ScopedStream const stream{ random::Stream{ seed, self } };
+
+            Individual                                                       offspring( initialPopulation.front() );
+            std::conditional_t< adaptive, detail::Credit, detail::NoCredit > credit;
+            detail::PhaseTimer< false >                                      timer;
+
+            for ( ;; )
+            {
+                {
+                    std::lock_guard< std::mutex > const lock{ mutex };
+                    if ( solved || started == maxEvaluations )
+                    {
+                        return;
+                    }
+                    ++started;
+
+                    auto const & parents{ std::as_const( population ) };
+                    detail::mate( crossover, mutation, selection( parents ), selection( parents ), offspring, NoChangeLog{}, credit, timer );
+                }
+
+                bound::repair( offspring );
+                offspring.penalty = problem.penalty( offspring         );
+                offspring.fitness = problem.fitness( offspring.penalty );
+
+                std::lock_guard< std::mutex > const lock{ mutex };
+
+                if constexpr ( adaptive )
+                {
+                    detail::rewardOffspring( crossover, mutation, offspring, credit );
+                    if ( ++rewarded % std::size( population ) == 0 )
+                    {
+                        detail::adapt( crossover, mutation );
+                    }
+                }
+
+                if ( auto const victim{ replacement( std::as_const( population ), std::as_const( offspring ) ) } )
+                {
+                    population[ *victim ] = offspring;
+
+                    if ( offspring.fitness > population[ best ].fitness )
+                    {
+                        best = *victim;
+                    }
+                    else if ( *victim == best )
+                    {
+                        best = detail::bestIndex( population );
+                    }
+
+                    solved = solved || std::abs( population[ best ].fitness - desiredFitness ) <= precision;
+                }
+            }
+        }
+    };
+
+    std::vector< std::thread > threads;
+    threads.reserve( threadCount );
+    for ( std::size_t i{ 0 }; i < threadCount; ++i )
+    {
+        threads.emplace_back
+        (
+            [ & evolve, & mutex, & solved, & exception, i ]()
+            {
+                try
+                {
+                    evolve( i );
+                }
+                catch ( ... )
+                {
+                    std::lock_guard< std::mutex > const lock{ mutex };
+                    solved = true;
+                    if ( !exception )
+                    {
+                        exception = std::current_exception();
+                    }
+                }
+            }
+        );
+    }
+
+    for ( auto & thread : threads )
+    {
+        thread.join();
+    }
+
+    if ( exception )
+    {
+        std::rethrow_exception( exception );
+    }
+
+    return Individual( population[ best ] );
+}
+
+}
+
+#endif // ECFCPP_METAHEURISTICS_GA_ASYNC_STEADY_STATE_HPP
@@ -0,0 +1,227 @@
+#ifndef ECFCPP_METAHEURISTICS_GA_BREED_HPP
+#define ECFCPP_METAHEURISTICS_GA_BREED_HPP
+
+#include <ecfcpp/bounds.hpp>
+#include <ecfcpp/change_log.hpp>
+#include <ecfcpp/crossovers/in_place.hpp>
+#include <ecfcpp/metaheuristics/ga/credit.hpp>
+#include <ecfcpp/metaheuristics/ga/observer.hpp>
+#include <ecfcpp/mutations/in_place.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ecfcpp::ga::detail
+{
+
+// Replaces child with a mutated offspring of mom and dad. Child may be one of
+// them. Offspring is left unrepaired.
+template< typename Crossover, typename Mutation, typename Parent, typename Child >
+void mate
+(
+    Crossover const & crossover,
+    Mutation  const & mutation,
+    Parent    const & mom,
+    Parent    const & dad,
+    Child          && child
+)
+{
+    ecfcpp::crossover::inPlace( crossover, mom, dad, child );
+    ecfcpp::mutation ::inPlace( mutation, child );
+}
+
+// As above, recording genes of child which change in log.
+template< typename Crossover, typename Mutation, typename Parent, typename Child, typename Log >
+void mate
+(
+    Crossover const & crossover,
+    Mutation  const & mutation,
+    Parent    const & mom,
+    Parent    const & dad,
+    Child          && child,
+    Log            && log
+)
+{
+    ecfcpp::crossover::inPlace( crossover, mom, dad, child, log );
+    ecfcpp::mutation ::inPlace( mutation, child, log );
+}
+
+// As above, also recording in credit which operators adaptive ones chose and
+// fitness of the better parent, unless credit is NoCredit. Time spent in
+// crossover and mutation is split on timer. Parents must be evaluated.
+template
+<
+    typename Crossover,
+    typename Mutation,
+    typename Parent,
+    typename Child,
+    typename Log,
+    typename ChildCredit,
+    typename Timer
+>
+void mate
+(
+    Crossover   const & crossover,
+    Mutation    const & mutation,
+    Parent      const & mom,
+    Parent      const & dad,
+    Child            && child,
+    Log              && log,
+    ChildCredit      && credit,
+    Timer             & timer
+)
+{
+    constexpr bool logChanges{ !std::is_same_v< std::decay_t< Log >, NoChangeLog > };
+
+    auto const cross
+    {
+        [ & ]( auto const & chosen )
+        {
+            if constexpr ( logChanges )
+            {
+                ecfcpp::crossover::inPlace( chosen, mom, dad, child, log );
+            }
+            else
+            {
+                ecfcpp::crossover::inPlace( chosen, mom, dad, child );
+            }
+            timer.lap( Phase::Crossover );
+        }
+    };
+
+    auto const mutate
+    {
+        [ & ]( auto const & chosen )
+        {
+            if constexpr ( logChanges )
+            {
+                ecfcpp::mutation::inPlace( chosen, child, log );
+            }
+            else
+            {
+                ecfcpp::mutation::inPlace( chosen, child );
+            }
+            timer.lap( Phase::Mutation );
+        }
+    };
+
+    if constexpr ( std::is_same_v< std::decay_t< ChildCredit >, NoCredit > )
+    {
+        cross ( crossover );
+        mutate( mutation  );
+    }
+    else
+    {
+        // Child may be one of the parents, so their fitness is read first.
+        credit.parentFitness = std::max< double >( mom.fitness, dad.fitness );
+
+        vary( crossover, credit.crossover, cross  );
+        vary( mutation,  credit.mutation,  mutate );
+    }
+}
+
+// Replaces child with a mutated offspring of two individuals selected from
+// population. Child may be one of them. Offspring is left unrepaired.
+template< typename Selection, typename Crossover, typename Mutation, typename Population, typename Child >
+void breed
+(
+    Selection  const & selection,
+    Crossover  const & crossover,
+    Mutation   const & mutation,
+    Population const & population,
+    Child           && child
+)
+{
+    mate( crossover, mutation, selection( population ), selection( population ), child );
+}
+
+// As above, recording genes of child which change in log.
+template< typename Selection, typename Crossover, typename Mutation, typename Population, typename Child, typename Log >
+void breed
+(
+    Selection  const & selection,
+    Crossover  const & crossover,
+    Mutation   const & mutation,
+    Population const & population,
+    Child           && child,
+    Log             && log
+)
+{
+    mate( crossover, mutation, selection( population ), selection( population ), child, log );
+}
+
+// Indices of count individuals of population picked by selection at once.
+// Storage is kept per thread and reused by the next call on the same thread.
+template< typename Selection, typename Population >
+std::vector< std::size_t > const & parentIndices( Selection const & selection, Population const & population, std::size_t const count )
+{
+    static thread_local std::vector< std::size_t > indices;
+    indices.resize( count );
+    selection.select( population, count, indices.data() );
+    return indices;
+}
+
+template< typename Population, typename = void >
+struct HasRangeRepair : std::false_type {};
+
+template< typename Population >
+struct HasRangeRepair
+<
+    Population,
+    std::void_t< decltype( std::declval< Population & >().repair( std::size_t{}, std::size_t{} ) ) >
+> : std::true_type {};
+
+// Brings individuals [begin, end) of population back into their bounds, in a
+// single pass when population supports it.
+template< typename Population >
+void repair( Population & population, std::size_t const begin, std::size_t const end )
+{
+    if constexpr ( HasRangeRepair< Population >::value )
+    {
+        population.repair( begin, end );
+    }
+    else
+    {
+        for ( std::size_t i{ begin }; i < end; ++i )
+        {
+            bound::repair( population[ i ] );
+        }
+    }
+}
+
+template< typename Individual, typename = void >
+struct HasGeneRepair : std::false_type {};
+
+template< typename Individual >
+struct HasGeneRepair
+<
+    Individual,
+    std::void_t< decltype( std::declval< Individual >().repair( std::size_t{} ) ) >
+> : std::true_type {};
+
+// Brings individual back into its bounds. Genes which log has not seen change
+// were repaired before, so only the recorded ones are repaired when it can.
+template< typename Individual, typename Log >
+void repair( Individual && individual, Log const & log )
+{
+    if constexpr ( HasGeneRepair< Individual && >::value )
+    {
+        if ( log.tracked() )
+        {
+            for ( auto const & change : log.records() )
+            {
+                individual.repair( change.index );
+            }
+            return;
+        }
+    }
+
+    bound::repair( individual );
+}
+
+}
+
+#endif // ECFCPP_METAHEURISTICS_GA_BREED_HPP
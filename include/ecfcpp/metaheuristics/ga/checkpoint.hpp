@@ -0,0 +1,52 @@
+#ifndef ECFCPP_METAHEURISTICS_GA_CHECKPOINT_HPP
+#define ECFCPP_METAHEURISTICS_GA_CHECKPOINT_HPP
+
+#include <ecfcpp/metaheuristics/ga/observer.hpp>
+#include <ecfcpp/utils/checkpoint.hpp>
+
+#include <cstdint>
+
+namespace ecfcpp::ga::observer
+{
+
+// Hands the population of every few generations to writer, which saves it in
+// the background. Generations are reported after evaluation and before any
+// random numbers are drawn for the next one, so a run resumed from a restored
+// checkpoint continues as the saved one would have, with two exceptions. Only
+// the population and the random stream are saved, so adaptive composites start
+// over from their initial probabilities. A resumed run also scores its first
+// generation in full, which may differ in the last bits from scores the saved
+// run updated from changes. Runs resumed from generation g should pass g as
+// offset, so their checkpoints keep counting from it. The last generation of a
+// run is not saved.
+class Checkpoint
+{
+public:
+    static constexpr bool timed{ false };
+
+    Checkpoint( checkpoint::Writer & writer, std::uint64_t const every, std::uint64_t const offset = 0 ) noexcept :
+        writer_{ writer },
+        every_ { every  },
+        offset_{ offset }
+    {}
+
+    template< typename Population >
+    void operator()( Generation< Population > const & generation ) const
+    {
+        auto const index{ generation.index + offset_ };
+
+        if ( generation.stop == Stop::None && every_ != 0 && index % every_ == 0 )
+        {
+            writer_.save( generation.population, index );
+        }
+    }
+
+private:
+    checkpoint::Writer & writer_;
+    std::uint64_t        every_;
+    std::uint64_t        offset_;
+};
+
+}
+
+#endif // ECFCPP_METAHEURISTICS_GA_CHECKPOINT_HPP
@@ -0,0 +1,158 @@
+#ifndef ECFCPP_METAHEURISTICS_GA_CREDIT_HPP
+#define ECFCPP_METAHEURISTICS_GA_CREDIT_HPP
+
+#include <ecfcpp/types.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace ecfcpp::ga::detail
+{
+
+// Choices adaptive operators made for an offspring and fitness of its better
+// parent, kept until the offspring is evaluated and its operators rewarded.
+struct Credit
+{
+    static constexpr std::size_t none{ std::numeric_limits< std::size_t >::max() };
+
+    std::size_t crossover    { none };
+    std::size_t mutation     { none };
+    double      parentFitness{ 0    };
+};
+
+// Stands in for credit of an offspring whose operators do not adapt.
+struct NoCredit {};
+
+// Stands in for credits of a population whose operators do not adapt.
+struct NoCredits {};
+
+template< typename Operator, typename = void >
+struct IsAdaptive : std::false_type {};
+
+template< typename Operator >
+struct IsAdaptive
+<
+    Operator,
+    std::void_t
+    <
+        decltype( std::declval< Operator const & >().choose() ),
+        decltype( std::declval< Operator const & >().reward( std::size_t{}, double{} ) ),
+        decltype( std::declval< Operator const & >().adapt() ),
+        decltype( std::declval< Operator const & >().reset() )
+    >
+> : std::true_type {};
+
+template< typename Operator >
+constexpr inline bool isAdaptive{ IsAdaptive< Operator >::value };
+
+// Credits of offspring bred into population, one for each slot, if either
+// operator can adapt.
+template< typename Crossover, typename Mutation, typename Population >
+auto credits( Crossover const &, Mutation const &, Population const & population )
+{
+    if constexpr ( isAdaptive< Crossover > || isAdaptive< Mutation > )
+    {
+        return Container< Credit >( std::size( population ) );
+    }
+    else
+    {
+        return NoCredits{};
+    }
+}
+
+// Credit of offspring in slot index.
+template< typename Credits >
+decltype( auto ) creditOf( Credits & credits, std::size_t const index )
+{
+    if constexpr ( std::is_same_v< Credits, NoCredits > )
+    {
+        return NoCredit{};
+    }
+    else
+    {
+        return ( credits[ index ] );
+    }
+}
+
+// Calls function with op, or with the operator op chooses if it is adaptive,
+// writing that choice to choice.
+template< typename Operator, typename Function >
+void vary( Operator const & op, std::size_t & choice, Function && function )
+{
+    if constexpr ( isAdaptive< Operator > )
+    {
+        choice = op.choose();
+        op.visit( choice, std::forward< Function >( function ) );
+    }
+    else
+    {
+        function( op );
+    }
+}
+
+// Rewards operators which bred evaluated offspring by how much it improved on
+// its better parent. Credit is spent.
+template< typename Crossover, typename Mutation, typename Individual >
+void rewardOffspring( Crossover const & crossover, Mutation const & mutation, Individual const & offspring, Credit & credit )
+{
+    auto const improvement{ offspring.fitness - credit.parentFitness };
+
+    if constexpr ( isAdaptive< Crossover > )
+    {
+        if ( credit.crossover != Credit::none )
+        {
+            crossover.reward( credit.crossover, improvement );
+        }
+    }
+
+    if constexpr ( isAdaptive< Mutation > )
+    {
+        if ( credit.mutation != Credit::none )
+        {
+            mutation.reward( credit.mutation, improvement );
+        }
+    }
+
+    credit = Credit{};
+}
+
+// Lets adaptive operators adapt to rewards since they last did.
+template< typename Crossover, typename Mutation >
+void adapt( Crossover const & crossover, Mutation const & mutation )
+{
+    if constexpr ( isAdaptive< Crossover > ) { crossover.adapt(); }
+    if constexpr ( isAdaptive< Mutation  > ) { mutation .adapt(); }
+}
+
+// Makes adaptive operators forget earlier runs. Engines call it as a run
+// starts, since operators are shared by const reference and keep what they
+// learn between runs otherwise.
+template< typename Crossover, typename Mutation >
+void reset( Crossover const & crossover, Mutation const & mutation )
+{
+    if constexpr ( isAdaptive< Crossover > ) { crossover.reset(); }
+    if constexpr ( isAdaptive< Mutation  > ) { mutation .reset(); }
+}
+
+// Rewards operators for evaluated offspring in population, then lets them
+// adapt. Credits are spent.
+template< typename Crossover, typename Mutation, typename Population, typename Credits >
+void reward( Crossover const & crossover, Mutation const & mutation, Population const & population, Credits & credits )
+{
+    if constexpr ( !std::is_same_v< Credits, NoCredits > )
+    {
+        for ( std::size_t i{ 0 }; i < std::size( population ); ++i )
+        {
+            rewardOffspring( crossover, mutation, population[ i ], credits[ i ] );
+        }
+
+        adapt( crossover, mutation );
+    }
+}
+
+}
+
+#endif // ECFCPP_METAHEURISTICS_GA_CREDIT_HPP
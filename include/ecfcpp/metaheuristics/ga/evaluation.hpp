@@ -0,0 +1,129 @@
+#ifndef ECFCPP_METAHEURISTICS_GA_EVALUATION_HPP
+#define ECFCPP_METAHEURISTICS_GA_EVALUATION_HPP
+
+#include <ecfcpp/change_log.hpp>
+#include <ecfcpp/selections/prepare.hpp>
+#include <ecfcpp/types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace ecfcpp::ga::detail
+{
+
+// Stands in for change logs of a population whose problem cannot use them.
+struct NoChangeLogs {};
+
+template< typename Problem, typename Individual, typename = void >
+struct UsesChangeLogs : std::false_type {};
+
+// Genes must be plain values, which change logs can hold.
+template< typename Problem, typename Individual >
+struct UsesChangeLogs< Problem, Individual, std::void_t< typename Problem::function_type > > :
+    std::bool_constant
+    <
+        isDeltaFunction< typename Problem::function_type, Individual > &&
+        std::is_same_v
+        <
+            std::decay_t< decltype( std::declval< Individual & >().data()[ 0 ] ) >,
+            typename Individual::value_type
+        >
+    >
+{};
+
+// Change logs of individuals of population, one for each, if problem can
+// update their scores from changes.
+template< typename Problem, typename Population >
+auto changeLogs( Problem const &, Population & population )
+{
+    using Individual = std::decay_t< decltype( population[ 0 ] ) >;
+
+    if constexpr ( UsesChangeLogs< Problem, Individual >::value )
+    {
+        using Log = ChangeLog< typename Individual::value_type >;
+
+        // Past a quarter of the genes, evaluating in full is about as fast.
+        auto const dimension{ std::empty( population ) ? 0 : std::size( population[ 0 ].data() ) };
+        return Container< Log >( std::size( population ), Log{ std::max< std::size_t >( dimension / 4, 1 ) } );
+    }
+    else
+    {
+        return NoChangeLogs{};
+    }
+}
+
+// Stands in for the change log of an individual whose problem cannot use change
+// logs, telling only whether its score is stale.
+class StaleFlag
+{
+public:
+    inline void invalidate() noexcept { stale_ = true;  }
+    inline void reset     () noexcept { stale_ = false; }
+
+    inline bool unchanged() const noexcept { return !stale_; }
+    inline bool updatable() const noexcept { return false;   }
+
+private:
+    bool stale_{ true };
+};
+
+using StaleFlags = Container< StaleFlag >;
+
+template< typename Problem, typename Individual, typename = void >
+struct UsesStaleFlags : std::false_type {};
+
+template< typename Problem, typename Individual >
+struct UsesStaleFlags< Problem, Individual, std::void_t< typename Problem::function_type > > :
+    std::bool_constant< !isDeltaFunction< typename Problem::function_type, Individual > >
+{};
+
+// Logs of individuals of population for engines which replace only some of
+// them: change logs if problem can use them, otherwise flags which spare
+// evaluating individuals that were not replaced, if problem evaluates by logs.
+template< typename Problem, typename Population >
+auto replacementLogs( Problem const & problem, Population & population )
+{
+    using Individual = std::decay_t< decltype( population[ 0 ] ) >;
+
+    if constexpr ( UsesChangeLogs< Problem, Individual >::value )
+    {
+        return changeLogs( problem, population );
+    }
+    else if constexpr ( UsesStaleFlags< Problem, Individual >::value )
+    {
+        return StaleFlags( std::size( population ) );
+    }
+    else
+    {
+        return NoChangeLogs{};
+    }
+}
+
+// Evaluates population, skipping or updating individuals whose logs allow it.
+template< typename Problem, typename Population, typename Logs >
+void evaluate( Problem const & problem, Population & population, Logs & logs )
+{
+    if constexpr ( std::is_same_v< Logs, NoChangeLogs > )
+    {
+        problem.evaluate( population );
+    }
+    else
+    {
+        problem.evaluate( population, logs );
+    }
+}
+
+// Number of individuals engines rank in order: all of them for selections
+// which need it, otherwise just the elite.
+template< typename Selection, typename Population >
+std::size_t rankedCount( std::size_t const eliteCount, Population const & population )
+{
+    return ecfcpp::selection::needsRanking< Selection > ? std::size( population ) : eliteCount;
+}
+
+}
+
+#endif // ECFCPP_METAHEURISTICS_GA_EVALUATION_HPP
@@ -1,81 +1,499 @@
 #ifndef ECFCPP_METAHEURISTICS_GA_GENERATIONAL_HPP
 #define ECFCPP_METAHEURISTICS_GA_GENERATIONAL_HPP
 
+#include <ecfcpp/metaheuristics/ga/breed.hpp>
+#include <ecfcpp/metaheuristics/ga/evaluation.hpp>
+#include <ecfcpp/metaheuristics/ga/observer.hpp>
+#include <ecfcpp/ranking.hpp>
+#include <ecfcpp/selections/prepare.hpp>
+#include <ecfcpp/utils/random.hpp>
+#include <ecfcpp/utils/thread_pool.hpp>
+
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <utility>
 
 namespace ecfcpp::ga
 {
 
-template< typename Problem, typename Selection, typename Crossover, typename Mutation, typename Population >
-[[ nodiscard ]] constexpr auto generational
+namespace detail
+{
+
+// Replaces population with its offspring. Its eliteCount best individuals, by
+// ranking, are copied unchanged; the rest are bred into nextPopulation which is
+// then swapped with population, and so are their change logs, logs and
+// nextLogs, unless they are NoChangeLogs. When parents are selected by index,
+// every logged child starts as a copy of its mom, with her score and log, so
+// that its log records just the genes breeding changes; otherwise it records
+// them against the individual the child overwrites. Choices of adaptive
+// operators for every bred slot are recorded in credits, unless they are
+// NoCredits. Time spent in every phase is split on timer. Expects population
+// to be evaluated and ranking to rank at least eliteCount of its individuals.
+template
+<
+    typename Selection,
+    typename Crossover,
+    typename Mutation,
+    typename Population,
+    typename Logs,
+    typename Credits,
+    typename Timer
+>
+void generationalStep
 (
-    bool          const   useElitism,
-    std::size_t   const   maxGenerations,
-    double        const   desiredFitness,
-    double        const   precision,
-    Problem       const & problem,
-    Selection     const & selection,
-    Crossover     const & crossover,
-    Mutation      const & mutation,
-    Population    const & initialPopulation,
-    std::uint16_t const   logFrequency = 0
+    parallel::ThreadPool *       threadPool,
+    std::size_t          const   chunkSize,
+    std::size_t          const   eliteCount,
+    Selection            const & selection,
+    Crossover            const & crossover,
+    Mutation             const & mutation,
+    Ranking              const & ranking,
+    Population                 & population,
+    Population                 & nextPopulation,
+    Logs                       & logs,
+    Logs                       & nextLogs,
+    Credits                    & credits,
+    Timer                      & timer
 )
 {
-    auto population{ initialPopulation };
-    auto nextPopulation{ initialPopulation };
-
-    for ( std::size_t i{ 0 }; i < maxGenerations; ++i )
-    {
-        problem.evaluate( population );
+    constexpr bool logChanges{ !std::is_same_v< Logs, NoChangeLogs > };
 
-        auto const & best{ *std::max_element( std::begin( population ), std::end( population ) ) };
+    auto && parents{ ecfcpp::selection::prepare( selection, population, ranking ) };
+    timer.lap( Phase::Selection );
 
-        if ( logFrequency > 0 && i % logFrequency == 0 )
+    auto const offspring
+    {
+        [ & ]( std::size_t const j, auto const & mom, auto const & dad, auto & breedTimer )
         {
-            std::cout << "Generation #" << i << '\n'
-                      << "  Fitness  = " << best.fitness << '\n'
-                      << "  Solution = " << best << '\n' << '\n';
+            breedTimer.lap( Phase::Selection );
+
+            if constexpr ( logChanges )
+            {
+                auto && child{ nextPopulation[ j ] };
+                detail::mate( crossover, mutation, mom, dad, child, nextLogs[ j ], creditOf( credits, j ), breedTimer );
+                detail::repair( child, nextLogs[ j ] );
+                breedTimer.lap( Phase::Replacement );
+            }
+            else
+            {
+                detail::mate( crossover, mutation, mom, dad, nextPopulation[ j ], NoChangeLog{}, creditOf( credits, j ), breedTimer );
+            }
         }
+    };
 
-        if ( std::abs( best.fitness - desiredFitness ) <= precision )
+    auto const breed
+    {
+        [ & ]( std::size_t const begin, std::size_t const end, auto & breedTimer )
         {
-            if ( logFrequency > 0 )
+            if constexpr ( ecfcpp::selection::hasSelect< decltype( parents ), Population > )
             {
-                std::cout << "Reached desired fitness in generation #" << i << ".\n\n";
+                // Parents of the whole range are selected at once, before any
+                // of them is bred.
+                auto const & indices{ parentIndices( parents, population, 2 * ( end - begin ) ) };
+                for ( std::size_t j{ begin }; j < end; ++j )
+                {
+                    auto const pair{ 2 * ( j - begin ) };
+
+                    if constexpr ( logChanges )
+                    {
+                        nextPopulation[ j ] = population[ indices[ pair ] ];
+                        nextLogs      [ j ] = logs      [ indices[ pair ] ];
+                    }
+
+                    offspring( j, std::as_const( population )[ indices[ pair ] ], std::as_const( population )[ indices[ pair + 1 ] ], breedTimer );
+                }
+            }
+            else
+            {
+                for ( std::size_t j{ begin }; j < end; ++j )
+                {
+                    offspring( j, parents( std::as_const( population ) ), parents( std::as_const( population ) ), breedTimer );
+                }
+            }
+
+            if constexpr ( !logChanges )
+            {
+                detail::repair( nextPopulation, begin, end );
+                breedTimer.lap( Phase::Replacement );
             }
-            return best;
         }
+    };
+
+    std::size_t const first{ std::min( eliteCount, ranking.sorted() ) };
+
+    for ( std::size_t j{ 0 }; j < first; ++j )
+    {
+        nextPopulation[ j ] = population[ ranking[ j ] ];
 
-        if ( useElitism )
+        if constexpr ( logChanges )
         {
-            nextPopulation[ 0 ] = best;
+            nextLogs[ j ] = logs[ ranking[ j ] ];
         }
+    }
+    timer.lap( Phase::Replacement );
+
+    if ( threadPool == nullptr )
+    {
+        breed( first, std::size( population ), timer );
+    }
+    else
+    {
+        // Every chunk of offspring draws from its own stream, identified by the
+        // first slot it fills, so the outcome does not depend on which thread
+        // happens to process the chunk.
+        auto const seed{ random::stream().nextSeed() };
+
+        threadPool->forEachChunk
+        (
+            std::size( population ) - first,
+            chunkSize,
+            [ & ]( std::size_t const begin, std::size_t const end )
+            {
+                random::ScopedStream const stream{ random::Stream{ seed, begin } };
+
+                PhaseTimer< Timer::enabled > chunkTimer;
+                breed( first + begin, first + end, chunkTimer );
+                timer.merge( chunkTimer );
+            }
+        );
+
+        // Breeding was timed by chunks.
+        timer.restart();
+    }
+
+    std::swap( population, nextPopulation );
+    std::swap( logs, nextLogs );
+    timer.lap( Phase::Replacement );
+}
+
+template< typename Selection, typename Crossover, typename Mutation, typename Population >
+void generationalStep
+(
+    parallel::ThreadPool *       threadPool,
+    std::size_t          const   chunkSize,
+    std::size_t          const   eliteCount,
+    Selection            const & selection,
+    Crossover            const & crossover,
+    Mutation             const & mutation,
+    Ranking              const & ranking,
+    Population                 & population,
+    Population                 & nextPopulation
+)
+{
+    NoChangeLogs        logs, nextLogs;
+    NoCredits           credits;
+    PhaseTimer< false > timer;
+    generationalStep
+    (
+        threadPool,
+        chunkSize,
+        eliteCount,
+        selection,
+        crossover,
+        mutation,
+        ranking,
+        population,
+        nextPopulation,
+        logs,
+        nextLogs,
+        credits,
+        timer
+    );
+}
+
+template
+<
+    typename Problem,
+    typename Selection,
+    typename Crossover,
+    typename Mutation,
+    typename Population,
+    typename Observer,
+    typename = std::enable_if_t< !std::is_arithmetic_v< std::decay_t< Observer > > >
+>
+[[ nodiscard ]] auto generational
+(
+    parallel::ThreadPool *       threadPool,
+    std::size_t          const   chunkSize,
+    std::size_t          const   eliteCount,
+    std::size_t          const   maxGenerations,
+    double               const   desiredFitness,
+    double               const   precision,
+    Problem              const & problem,
+    Selection            const & selection,
+    Crossover            const & crossover,
+    Mutation             const & mutation,
+    Population           const & initialPopulation,
+    Observer                   & observer
+)
+{
+    using Individual = typename Population::value_type;
+
+    auto population{ initialPopulation };
+    auto nextPopulation{ initialPopulation };
+
+    auto logs{ changeLogs( problem, population ) };
+    auto nextLogs{ logs };
+
+    auto credits{ detail::credits( crossover, mutation, population ) };
+    detail::reset( crossover, mutation );
+
+    Ranking ranking;
+
+    Observation< Observer > observation{ observer };
 
-        for ( std::size_t j{ useElitism ? 1UL : 0UL }; j < std::size( population ); ++j )
+    for ( std::size_t i{ 0 }; i < maxGenerations; ++i )
+    {
+        observation.evaluating( population, logs );
+        detail::evaluate( problem, population, logs );
+        detail::reward( crossover, mutation, population, credits );
+        ranking.update( population, rankedCount< Selection >( eliteCount, population ) );
+
+        auto const & best{ population[ ranking.best() ] };
+        auto const   reached{ std::abs( best.fitness - desiredFitness ) <= precision };
+
+        observation.report( i, population, ranking, reached ? Stop::DesiredFitness : Stop::None );
+
+        if ( reached )
         {
-            nextPopulation[ j ] =
-                mutation
-                (
-                    crossover
-                    (
-                        selection( population ),
-                        selection( population )
-                    )[ 0 ]
-                );
+            return Individual( best );
         }
 
-        std::swap( population, nextPopulation );
+        generationalStep
+        (
+            threadPool,
+            chunkSize,
+            eliteCount,
+            selection,
+            crossover,
+            mutation,
+            ranking,
+            population,
+            nextPopulation,
+            logs,
+            nextLogs,
+            credits,
+            observation.timer()
+        );
     }
 
+    observation.evaluating( population, logs );
+    detail::evaluate( problem, population, logs );
+    ranking.update( population, 1 );
+    observation.report( maxGenerations, population, ranking, Stop::MaxGenerations );
+    return Individual( population[ ranking.best() ] );
+}
+
+template< typename Problem, typename Selection, typename Crossover, typename Mutation, typename Population >
+[[ nodiscard ]] auto generational
+(
+    parallel::ThreadPool *       threadPool,
+    std::size_t          const   chunkSize,
+    std::size_t          const   eliteCount,
+    std::size_t          const   maxGenerations,
+    double               const   desiredFitness,
+    double               const   precision,
+    Problem              const & problem,
+    Selection            const & selection,
+    Crossover            const & crossover,
+    Mutation             const & mutation,
+    Population           const & initialPopulation,
+    std::uint16_t        const   logFrequency
+)
+{
+    auto const run
+    {
+        [ & ]( auto && observer )
+        {
+            return generational
+            (
+                threadPool,
+                chunkSize,
+                eliteCount,
+                maxGenerations,
+                desiredFitness,
+                precision,
+                problem,
+                selection,
+                crossover,
+                mutation,
+                initialPopulation,
+                observer
+            );
+        }
+    };
+
     if ( logFrequency > 0 )
     {
-        std::cout << "Maximum generations reached.\n\n";
+        return run( observer::Log{ std::cout, logFrequency } );
     }
-    problem.evaluate( population );
-    return *std::max_element( std::begin( population ), std::end( population ) );
+    return run( observer::None{} );
+}
+
+}
+
+// Copies eliteCount best individuals of every generation into the next one
+// unchanged; true and false stand for one and none. Logs progress to standard
+// output every logFrequency generations, unless it is zero.
+template< typename Problem, typename Selection, typename Crossover, typename Mutation, typename Population >
+[[ nodiscard ]] constexpr auto generational
+(
+    std::size_t   const   eliteCount,
+    std::size_t   const   maxGenerations,
+    double        const   desiredFitness,
+    double        const   precision,
+    Problem       const & problem,
+    Selection     const & selection,
+    Crossover     const & crossover,
+    Mutation      const & mutation,
+    Population    const & initialPopulation,
+    std::uint16_t const   logFrequency = 0
+)
+{
+    return detail::generational
+    (
+        nullptr,
+        0,
+        eliteCount,
+        maxGenerations,
+        desiredFitness,
+        precision,
+        problem,
+        selection,
+        crossover,
+        mutation,
+        initialPopulation,
+        logFrequency
+    );
+}
+
+// As above, reporting every generation to observer, see Generation.
+template
+<
+    typename Problem,
+    typename Selection,
+    typename Crossover,
+    typename Mutation,
+    typename Population,
+    typename Observer,
+    typename = std::enable_if_t< !std::is_arithmetic_v< std::decay_t< Observer > > >
+>
+[[ nodiscard ]] auto generational
+(
+    std::size_t const   eliteCount,
+    std::size_t const   maxGenerations,
+    double      const   desiredFitness,
+    double      const   precision,
+    Problem     const & problem,
+    Selection   const & selection,
+    Crossover   const & crossover,
+    Mutation    const & mutation,
+    Population  const & initialPopulation,
+    Observer         && observer
+)
+{
+    return detail::generational
+    (
+        nullptr,
+        0,
+        eliteCount,
+        maxGenerations,
+        desiredFitness,
+        precision,
+        problem,
+        selection,
+        crossover,
+        mutation,
+        initialPopulation,
+        observer
+    );
+}
+
+// Produces offspring of every generation on the given thread pool, chunkSize
+// slots at a time. Selection, crossover and mutation must be safe to call
+// concurrently. For a given seed and a non-zero chunk size, the result does not
+// depend on the number of threads in the pool.
+template< typename Problem, typename Selection, typename Crossover, typename Mutation, typename Population >
+[[ nodiscard ]] auto generational
+(
+    parallel::ThreadPool       & threadPool,
+    std::size_t          const   chunkSize,
+    std::size_t          const   eliteCount,
+    std::size_t          const   maxGenerations,
+    double               const   desiredFitness,
+    double               const   precision,
+    Problem              const & problem,
+    Selection            const & selection,
+    Crossover            const & crossover,
+    Mutation             const & mutation,
+    Population           const & initialPopulation,
+    std::uint16_t        const   logFrequency = 0
+)
+{
+    return detail::generational
+    (
+        &threadPool,
+        chunkSize,
+        eliteCount,
+        maxGenerations,
+        desiredFitness,
+        precision,
+        problem,
+        selection,
+        crossover,
+        mutation,
+        initialPopulation,
+        logFrequency
+    );
+}
+
+// As above, reporting every generation to observer, see Generation.
+template
+<
+    typename Problem,
+    typename Selection,
+    typename Crossover,
+    typename Mutation,
+    typename Population,
+    typename Observer,
+    typename = std::enable_if_t< !std::is_arithmetic_v< std::decay_t< Observer > > >
+>
+[[ nodiscard ]] auto generational
+(
+    parallel::ThreadPool       & threadPool,
+    std::size_t          const   chunkSize,
+    std::size_t          const   eliteCount,
+    std::size_t          const   maxGenerations,
+    double               const   desiredFitness,
+    double               const   precision,
+    Problem              const & problem,
+    Selection            const & selection,
+    Crossover            const & crossover,
+    Mutation             const & mutation,
+    Population           const & initialPopulation,
+    Observer                  && observer
+)
+{
+    return detail::generational
+    (
+        &threadPool,
+        chunkSize,
+        eliteCount,
+        maxGenerations,
+        desiredFitness,
+        precision,
+        problem,
+        selection,
+        crossover,
+        mutation,
+        initialPopulation,
+        observer
+    );
 }
 
 }
@@ -0,0 +1,530 @@
+#ifndef ECFCPP_METAHEURISTICS_GA_ISLAND_HPP
+#define ECFCPP_METAHEURISTICS_GA_ISLAND_HPP
+
+#include <ecfcpp/metaheuristics/ga/generational.hpp>
+#include <ecfcpp/metaheuristics/ga/observer.hpp>
+#include <ecfcpp/metaheuristics/ga/steady_state.hpp>
+#include <ecfcpp/ranking.hpp>
+#include <ecfcpp/types.hpp>
+#include <ecfcpp/utils/random.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace ecfcpp::ga
+{
+
+// Algorithm evolving each island between migrations.
+namespace model
+{
+
+struct Generational
+{
+    // Best individuals copied into the next generation unchanged.
+    std::size_t eliteCount{ 1 };
+};
+
+struct SteadyState
+{
+    float mortalityRate;
+};
+
+}
+
+enum class Topology : std::uint8_t
+{
+    Ring,     // Island i sends migrants to island i + 1.
+    FullMesh, // Every island sends migrants to all other islands.
+    Random    // Every island sends migrants to one randomly chosen island.
+};
+
+namespace detail
+{
+
+inline std::size_t eliteCount( model::Generational const & model ) noexcept { return model.eliteCount; }
+inline std::size_t eliteCount( model::SteadyState  const &       ) noexcept { return 1;                }
+
+template< typename Selection, typename Crossover, typename Mutation, typename Population, typename Timer >
+void step
+(
+    model::Generational const & model,
+    Selection           const & selection,
+    Crossover           const & crossover,
+    Mutation            const & mutation,
+    Ranking             const & ranking,
+    Population                & population,
+    Population                & nextPopulation,
+    Timer                     & timer
+)
+{
+    NoChangeLogs logs, nextLogs;
+    NoCredits    credits;
+    generationalStep
+    (
+        nullptr,
+        0,
+        model.eliteCount,
+        selection,
+        crossover,
+        mutation,
+        ranking,
+        population,
+        nextPopulation,
+        logs,
+        nextLogs,
+        credits,
+        timer
+    );
+}
+
+template< typename Selection, typename Crossover, typename Mutation, typename Population, typename Timer >
+void step
+(
+    model::SteadyState const & model,
+    Selection          const & selection,
+    Crossover          const & crossover,
+    Mutation           const & mutation,
+    Ranking            const & ranking,
+    Population               & population,
+    Population               &,
+    Timer                    & timer
+)
+{
+    NoChangeLogs logs;
+    NoCredits    credits;
+    steadyStateStep( model.mortalityRate, selection, crossover, mutation, ranking, population, logs, credits, timer );
+}
+
+// Passes generations of all islands to observer, one at a time.
+template< typename Observer >
+class SharedObserver
+{
+public:
+    static constexpr bool timed{ isTimed< Observer > };
+
+    SharedObserver( Observer & observer, std::mutex & mutex ) noexcept : observer_{ observer }, mutex_{ mutex } {}
+
+    template< typename Population >
+    void operator()( Generation< Population > const & generation ) const
+    {
+        std::lock_guard< std::mutex > const lock{ mutex_ };
+        observer_( generation );
+    }
+
+private:
+    Observer   & observer_;
+    std::mutex & mutex_;
+};
+
+// Mailboxes for every ordered pair of islands. A mailbox holds the most recent
+// batch of migrants which was not yet received; newer batch replaces an older
+// one. Sending and receiving is a single atomic exchange.
+template< typename Migrants >
+class Mailboxes
+{
+public:
+    explicit Mailboxes( std::size_t const islandCount ) :
+        islandCount_{ islandCount                                                       },
+        slots_      { std::make_unique< std::atomic< Migrants * >[] >( islandCount * islandCount ) }
+    {
+        for ( std::size_t i{ 0 }; i < islandCount_ * islandCount_; ++i )
+        {
+            slots_[ i ].store( nullptr, std::memory_order_relaxed );
+        }
+    }
+
+    Mailboxes( Mailboxes const & ) = delete;
+    Mailboxes & operator=( Mailboxes const & ) = delete;
+
+    ~Mailboxes()
+    {
+        for ( std::size_t i{ 0 }; i < islandCount_ * islandCount_; ++i )
+        {
+            delete slots_[ i ].load( std::memory_order_relaxed );
+        }
+    }
+
+    void send( std::size_t const from, std::size_t const to, Migrants const & migrants )
+    {
+        delete slot( from, to ).exchange( new Migrants( migrants ), std::memory_order_acq_rel );
+    }
+
+    std::unique_ptr< Migrants > receive( std::size_t const from, std::size_t const to )
+    {
+        return std::unique_ptr< Migrants >( slot( from, to ).exchange( nullptr, std::memory_order_acq_rel ) );
+    }
+
+private:
+    inline std::atomic< Migrants * > & slot( std::size_t const from, std::size_t const to )
+    {
+        return slots_[ from * islandCount_ + to ];
+    }
+
+    std::size_t islandCount_;
+    std::unique_ptr< std::atomic< Migrants * >[] > slots_;
+};
+
+template< typename Population >
+std::vector< std::size_t > rankedIndices( Population const & population, std::size_t const count, bool const best )
+{
+    std::vector< std::size_t > indices( std::size( population ) );
+    std::iota( std::begin( indices ), std::end( indices ), 0 );
+    std::partial_sort
+    (
+        std::begin( indices ),
+        std::begin( indices ) + count,
+        std::end  ( indices ),
+        [ & population, best ]( std::size_t const lhs, std::size_t const rhs )
+        {
+            return best ? population[ rhs ] < population[ lhs ] : population[ lhs ] < population[ rhs ];
+        }
+    );
+    indices.resize( count );
+    return indices;
+}
+
+template< typename Population, typename Migrants >
+void migrate
+(
+    Topology            const   topology,
+    std::size_t         const   migrationSize,
+    std::size_t         const   self,
+    std::size_t         const   islandCount,
+    Mailboxes< Migrants >     & mailboxes,
+    Population                & population
+)
+{
+    Migrants migrants;
+    migrants.reserve( migrationSize );
+    for ( auto const index : rankedIndices( population, migrationSize, true ) )
+    {
+        migrants.push_back( population[ index ] );
+    }
+
+    switch ( topology )
+    {
+        case Topology::Ring:
+            mailboxes.send( self, ( self + 1 ) % islandCount, migrants );
+            break;
+        case Topology::FullMesh:
+            for ( std::size_t to{ 0 }; to < islandCount; ++to )
+            {
+                if ( to != self )
+                {
+                    mailboxes.send( self, to, migrants );
+                }
+            }
+            break;
+        case Topology::Random:
+        {
+            auto const to{ random::uniform< std::size_t >( 0, islandCount - 1 ) };
+            mailboxes.send( self, to < self ? to : to + 1, migrants );
+            break;
+        }
+    }
+
+    for ( std::size_t from{ 0 }; from < islandCount; ++from )
+    {
+        if ( from == self )
+        {
+            continue;
+        }
+
+        if ( auto const immigrants{ mailboxes.receive( from, self ) } )
+        {
+            auto const worst{ rankedIndices( population, std::size( *immigrants ), false ) };
+            for ( std::size_t i{ 0 }; i < std::size( worst ); ++i )
+            {
+                population[ worst[ i ] ] = ( *immigrants )[ i ];
+            }
+        }
+    }
+}
+
+template
+<
+    typename Model,
+    typename Problem,
+    typename Selection,
+    typename Crossover,
+    typename Mutation,
+    typename Population,
+    typename Observer
+>
+[[ nodiscard ]] auto island
+(
+    Model       const   model,
+    std::size_t const   islandCount,
+    Topology    const   topology,
+    std::size_t const   migrationInterval,
+    std::size_t const   migrationSize,
+    std::size_t const   maxGenerations,
+    double      const   desiredFitness,
+    double      const   precision,
+    Problem     const & problem,
+    Selection   const & selection,
+    Crossover   const & crossover,
+    Mutation    const & mutation,
+    Population  const & initialPopulation,
+    Observer          & observer
+)
+{
+    assert( islandCount > 0 );
+    assert( std::size( initialPopulation ) >= islandCount );
+    assert( migrationSize <= std::size( initialPopulation ) / islandCount );
+
+    using Individual = typename Population::value_type;
+
+    detail::Mailboxes< Container< Individual > > mailboxes{ islandCount };
+    Container< Individual >                      results( islandCount, Individual( initialPopulation.front() ) );
+    std::atomic< bool >             solved{ false };
+    std::mutex                      mutex;
+    std::exception_ptr              exception;
+
+    detail::reset( crossover, mutation );
+
+    auto const seed{ random::stream().nextSeed() };
+
+    auto const evolve
+    {
+        [ & ]( std::size_t const self )
+        {
+            random::ScopedStream const stream{ random::Stream{ seed, self } };
+
+            auto const size{ std::size( initialPopulation ) };
+            Population population
+            (
+                std::next( std::begin( initialPopulation ), static_cast< std::ptrdiff_t >( self * size / islandCount ) ),
+                std::next( std::begin( initialPopulation ), static_cast< std::ptrdiff_t >( ( self + 1 ) * size / islandCount ) )
+            );
+            auto nextPopulation{ population };
+
+            Ranking ranking;
+
+            auto islandObserver
+            {
+                [ & ]()
+                {
+                    if constexpr ( isObserved< Observer > )
+                    {
+                        return SharedObserver< Observer >{ observer, mutex };
+                    }
+                    else
+                    {
+                        return observer::None{};
+                    }
+                }()
+            };
+
+            Observation< decltype( islandObserver ) > observation{ islandObserver, self };
+
+            std::size_t i{ 0 };
+            for ( ; i < maxGenerations && !solved.load( std::memory_order_relaxed ); ++i )
+            {
+                observation.evaluating( population, NoChangeLogs{} );
+                problem.evaluate( population );
+
+                if ( migrationInterval > 0 && islandCount > 1 && i > 0 && i % migrationInterval == 0 )
+                {
+                    detail::migrate( topology, migrationSize, self, islandCount, mailboxes, population );
+                }
+
+                ranking.update( population, detail::rankedCount< Selection >( detail::eliteCount( model ), population ) );
+
+                auto const & best{ population[ ranking.best() ] };
+                auto const   reached{ std::abs( best.fitness - desiredFitness ) <= precision };
+
+                observation.report( i, population, ranking, reached ? Stop::DesiredFitness : Stop::None );
+
+                if ( reached )
+                {
+                    results[ self ] = Individual( best );
+                    solved.store( true, std::memory_order_relaxed );
+                    return;
+                }
+
+                detail::step( model, selection, crossover, mutation, ranking, population, nextPopulation, observation.timer() );
+            }
+
+            observation.evaluating( population, NoChangeLogs{} );
+            problem.evaluate( population );
+            ranking.update( population, 1 );
+            results[ self ] = population[ ranking.best() ];
+
+            // Islands stopped by another one reaching desired fitness are not
+            // reported again.
+            if ( i == maxGenerations )
+            {
+                observation.report( maxGenerations, population, ranking, Stop::MaxGenerations );
+            }
+        }
+    };
+
+    std::vector< std::thread > islands;
+    islands.reserve( islandCount );
+    for ( std::size_t i{ 0 }; i < islandCount; ++i )
+    {
+        islands.emplace_back
+        (
+            [ & evolve, & mutex, & exception, & solved, i ]()
+            {
+                try
+                {
+                    evolve( i );
+                }
+                catch ( ... )
+                {
+                    // Other islands stop at their next generation.
+                    solved.store( true, std::memory_order_relaxed );
+
+                    std::lock_guard< std::mutex > const lock{ mutex };
+                    if ( !exception )
+                    {
+                        exception = std::current_exception();
+                    }
+                }
+            }
+        );
+    }
+
+    for ( auto & thread : islands )
+    {
+        thread.join();
+    }
+
+    if ( exception )
+    {
+        std::rethrow_exception( exception );
+    }
+
+    return *std::max_element( std::begin( results ), std::end( results ) );
+}
+
+}
+
+// Evolves islandCount sub-populations of initialPopulation on separate threads.
+// Every migrationInterval generations each island sends copies of its
+// migrationSize best individuals to its neighbours in the topology and replaces
+// its worst individuals with migrants it received since the last migration.
+// Islands never wait for each other, so the result of a run is not reproducible
+// even for a fixed seed. Run stops as soon as any island reaches desired fitness.
+// Problem, selection, crossover and mutation must be safe to call concurrently.
+// Logs progress of every island to standard output every logFrequency
+// generations, unless it is zero.
+template< typename Model, typename Problem, typename Selection, typename Crossover, typename Mutation, typename Population >
+[[ nodiscard ]] auto island
+(
+    Model         const   model,
+    std::size_t   const   islandCount,
+    Topology      const   topology,
+    std::size_t   const   migrationInterval,
+    std::size_t   const   migrationSize,
+    std::size_t   const   maxGenerations,
+    double        const   desiredFitness,
+    double        const   precision,
+    Problem       const & problem,
+    Selection     const & selection,
+    Crossover     const & crossover,
+    Mutation      const & mutation,
+    Population    const & initialPopulation,
+    std::uint16_t const   logFrequency = 0
+)
+{
+    auto const run
+    {
+        [ & ]( auto && observer )
+        {
+            return detail::island
+            (
+                model,
+                islandCount,
+                topology,
+                migrationInterval,
+                migrationSize,
+                maxGenerations,
+                desiredFitness,
+                precision,
+                problem,
+                selection,
+                crossover,
+                mutation,
+                initialPopulation,
+                observer
+            );
+        }
+    };
+
+    if ( logFrequency > 0 )
+    {
+        return run( observer::Log{ std::cout, logFrequency } );
+    }
+    return run( observer::None{} );
+}
+
+// As above, reporting every generation of every island to observer, see
+// Generation. Observer is called from the threads of the islands, one call at
+// a time; Generation::island tells islands apart.
+template
+<
+    typename Model,
+    typename Problem,
+    typename Selection,
+    typename Crossover,
+    typename Mutation,
+    typename Population,
+    typename Observer,
+    typename = std::enable_if_t< !std::is_arithmetic_v< std::decay_t< Observer > > >
+>
+[[ nodiscard ]] auto island
+(
+    Model       const   model,
+    std::size_t const   islandCount,
+    Topology    const   topology,
+    std::size_t const   migrationInterval,
+    std::size_t const   migrationSize,
+    std::size_t const   maxGenerations,
+    double      const   desiredFitness,
+    double      const   precision,
+    Problem     const & problem,
+    Selection   const & selection,
+    Crossover   const & crossover,
+    Mutation    const & mutation,
+    Population  const & initialPopulation,
+    Observer         && observer
+)
+{
+    return detail::island
+    (
+        model,
+        islandCount,
+        topology,
+        migrationInterval,
+        migrationSize,
+        maxGenerations,
+        desiredFitness,
+        precision,
+        problem,
+        selection,
+        crossover,
+        mutation,
+        initialPopulation,
+        observer
+    );
+}
+
+}
+
+#endif // ECFCPP_METAHEURISTICS_GA_ISLAND_HPP
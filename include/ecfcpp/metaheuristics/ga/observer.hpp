@@ -0,0 +1,365 @@
+#ifndef ECFCPP_METAHEURISTICS_GA_OBSERVER_HPP
+#define ECFCPP_METAHEURISTICS_GA_OBSERVER_HPP
+
+#include <ecfcpp/metaheuristics/ga/evaluation.hpp>
+#include <ecfcpp/ranking.hpp>
+#include <ecfcpp/span.hpp>
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+namespace ecfcpp::ga
+{
+
+// Phases of a generation timed for observers. Evaluation covers scoring the
+// population, rewarding adaptive operators and ranking; replacement covers
+// copying the elite, repairing offspring and putting them in place.
+enum class Phase : std::uint8_t
+{
+    Evaluation,
+    Selection,
+    Crossover,
+    Mutation,
+    Replacement
+};
+
+// Time spent in every phase. Offspring bred in parallel add up time of all
+// threads, which can then exceed the wall time.
+class Timings
+{
+public:
+    using duration = std::chrono::nanoseconds;
+
+    static constexpr std::size_t phaseCount{ 5 };
+
+    constexpr duration   operator[]( Phase const phase ) const noexcept { return durations_[ static_cast< std::size_t >( phase ) ]; }
+    constexpr duration & operator[]( Phase const phase )       noexcept { return durations_[ static_cast< std::size_t >( phase ) ]; }
+
+    constexpr duration total() const noexcept
+    {
+        duration sum{ 0 };
+        for ( auto const time : durations_ )
+        {
+            sum += time;
+        }
+        return sum;
+    }
+
+    constexpr Timings & operator+=( Timings const & other ) noexcept
+    {
+        for ( std::size_t i{ 0 }; i < phaseCount; ++i )
+        {
+            durations_[ i ] += other.durations_[ i ];
+        }
+        return *this;
+    }
+
+private:
+    std::array< duration, phaseCount > durations_{};
+};
+
+// Why a run stopped, if it did.
+enum class Stop : std::uint8_t
+{
+    None,
+    DesiredFitness,
+    MaxGenerations
+};
+
+// Fitness of an evaluated population.
+struct FitnessStatistics
+{
+    double best;
+    double mean;
+    double deviation;
+};
+
+// What an engine reports to its observer about generation index once it is
+// evaluated. Timings are those of breeding the generation, none for the initial
+// one, and evaluating it. The last report of a run that reached maxGenerations
+// has index maxGenerations and is only evaluated. Evaluations count
+// individuals scored, in full or from changes; unchanged ones are not scored
+// again. Island is the island of the population in runs of the island model.
+template< typename Population >
+struct Generation
+{
+    std::size_t                  index;
+    Population           const & population;
+    std::size_t                  best;
+    FitnessStatistics            fitness;
+    std::size_t                  evaluations;
+    std::size_t                  totalEvaluations;
+    Timings                      timings;
+    Stop                         stop;
+    std::optional< std::size_t > island;
+};
+
+// Observers are called as observer( generation ) for every generation of a
+// run, with Generation above. Observers which do not need timings declare
+// static constexpr bool timed{ false }, which spares the engine timing phases.
+namespace observer
+{
+
+// Observes nothing. Engines given it neither time phases nor compute
+// statistics.
+struct None
+{
+    template< typename Population >
+    constexpr void operator()( Generation< Population > const & ) const noexcept {}
+};
+
+// Prints the best individual every frequency generations, and why the run
+// stopped.
+class Log
+{
+public:
+    static constexpr bool timed{ false };
+
+    Log( std::ostream & stream, std::uint16_t const frequency ) noexcept : stream_{ stream }, frequency_{ frequency } {}
+
+    template< typename Population >
+    void operator()( Generation< Population > const & generation ) const
+    {
+        if ( generation.stop == Stop::MaxGenerations )
+        {
+            if ( generation.island )
+            {
+                stream_ << "Island #" << *generation.island << " reached maximum generations.\n\n";
+            }
+            else
+            {
+                stream_ << "Maximum generations reached.\n\n";
+            }
+            return;
+        }
+
+        if ( frequency_ > 0 && generation.index % frequency_ == 0 )
+        {
+            if ( generation.island )
+            {
+                stream_ << "Island #" << *generation.island << ", generation #" << generation.index << '\n';
+            }
+            else
+            {
+                stream_ << "Generation #" << generation.index << '\n';
+            }
+            stream_ << "  Fitness  = " << generation.fitness.best << '\n'
+                    << "  Solution = " << generation.population[ generation.best ] << '\n' << '\n';
+        }
+
+        if ( generation.stop == Stop::DesiredFitness )
+        {
+            if ( generation.island )
+            {
+                stream_ << "Island #" << *generation.island << " reached desired fitness in generation #" << generation.index << ".\n\n";
+            }
+            else
+            {
+                stream_ << "Reached desired fitness in generation #" << generation.index << ".\n\n";
+            }
+        }
+    }
+
+private:
+    std::ostream  & stream_;
+    std::uint16_t   frequency_;
+};
+
+}
+
+template< typename Observer >
+constexpr inline bool isObserved{ !std::is_same_v< std::decay_t< Observer >, observer::None > };
+
+template< typename Observer, typename = void >
+struct IsTimed : std::true_type {};
+
+template< typename Observer >
+struct IsTimed< Observer, std::void_t< decltype( Observer::timed ) > > : std::bool_constant< Observer::timed > {};
+
+template< typename Observer >
+constexpr inline bool isTimed{ isObserved< Observer > && IsTimed< std::decay_t< Observer > >::value };
+
+namespace detail
+{
+
+// Splits time between phases as it passes: lap( phase ) adds time since the
+// previous lap, or restart, to phase. Does nothing unless Enabled.
+template< bool Enabled >
+class PhaseTimer
+{
+public:
+    static constexpr bool enabled{ Enabled };
+
+    using Clock = std::chrono::steady_clock;
+
+    inline void restart() noexcept { mark_ = Clock::now(); }
+
+    inline void lap( Phase const phase ) noexcept
+    {
+        auto const now{ Clock::now() };
+        timings_[ phase ] += std::chrono::duration_cast< Timings::duration >( now - mark_ );
+        mark_ = now;
+    }
+
+    // Adds timings of a timer of another thread.
+    inline void merge( PhaseTimer const & other )
+    {
+        std::lock_guard< std::mutex > const lock{ mutex_ };
+        timings_ += other.timings_;
+    }
+
+    // Timings so far, starting anew.
+    inline Timings take() noexcept { return std::exchange( timings_, Timings{} ); }
+
+private:
+    Clock::time_point mark_{ Clock::now() };
+    Timings           timings_;
+    std::mutex        mutex_;
+};
+
+template<>
+class PhaseTimer< false >
+{
+public:
+    static constexpr bool enabled{ false };
+
+    constexpr void restart() noexcept {}
+    constexpr void lap( Phase ) noexcept {}
+    constexpr void merge( PhaseTimer const & ) noexcept {}
+
+    constexpr Timings take() const noexcept { return {}; }
+};
+
+// Best, mean and standard deviation of fitnesses, in one pass.
+inline FitnessStatistics statistics( Span< double const > const fitnesses ) noexcept
+{
+    FitnessStatistics result{ 0, 0, 0 };
+    if ( fitnesses.empty() )
+    {
+        return result;
+    }
+
+    result.best = fitnesses[ 0 ];
+
+    double squares{ 0 };
+    std::size_t count{ 0 };
+    for ( auto const fitness : fitnesses )
+    {
+        ++count;
+        auto const delta{ fitness - result.mean };
+        result.mean += delta / static_cast< double >( count );
+        squares     += delta * ( fitness - result.mean );
+        result.best  = fitness > result.best ? fitness : result.best;
+    }
+
+    result.deviation = std::sqrt( squares / static_cast< double >( count ) );
+    return result;
+}
+
+// Number of individuals of population the next evaluation scores.
+template< typename Population, typename Logs >
+std::size_t pendingEvaluations( Population const & population, Logs const & logs )
+{
+    if constexpr ( std::is_same_v< Logs, NoChangeLogs > )
+    {
+        return std::size( population );
+    }
+    else
+    {
+        std::size_t count{ 0 };
+        for ( auto const & log : logs )
+        {
+            count += log.unchanged() ? 0 : 1;
+        }
+        return count;
+    }
+}
+
+// Instruments a run for observer: times its phases, unless observer is not
+// timed, counts evaluations and reports generations. Compiles to nothing for
+// observer::None.
+template< typename Observer, bool = isObserved< Observer > >
+class Observation
+{
+public:
+    Observation( Observer & observer, std::optional< std::size_t > const island = std::nullopt ) noexcept :
+        observer_{ observer },
+        island_  { island   }
+    {}
+
+    inline PhaseTimer< isTimed< Observer > > & timer() noexcept { return timer_; }
+
+    // Called right before population is evaluated.
+    template< typename Population, typename Logs >
+    void evaluating( Population const & population, Logs const & logs )
+    {
+        evaluations_       = pendingEvaluations( population, logs );
+        totalEvaluations_ += evaluations_;
+    }
+
+    // Called once population is evaluated and ranked.
+    template< typename Population >
+    void report( std::size_t const index, Population const & population, Ranking const & ranking, Stop const stop )
+    {
+        timer_.lap( Phase::Evaluation );
+
+        observer_
+        (
+            Generation< Population >
+            {
+                index,
+                population,
+                ranking.best(),
+                statistics( ranking.fitnesses() ),
+                evaluations_,
+                totalEvaluations_,
+                timer_.take(),
+                stop,
+                island_
+            }
+        );
+
+        // Time spent observing is left out.
+        timer_.restart();
+    }
+
+private:
+    Observer                              & observer_;
+    std::optional< std::size_t >            island_;
+    PhaseTimer< isTimed< Observer > >       timer_;
+    std::size_t                             evaluations_     { 0 };
+    std::size_t                             totalEvaluations_{ 0 };
+};
+
+template< typename Observer >
+class Observation< Observer, false >
+{
+public:
+    constexpr Observation( Observer &, std::optional< std::size_t > = std::nullopt ) noexcept {}
+
+    inline PhaseTimer< false > & timer() noexcept { return timer_; }
+
+    template< typename Population, typename Logs >
+    constexpr void evaluating( Population const &, Logs const & ) noexcept {}
+
+    template< typename Population >
+    constexpr void report( std::size_t, Population const &, Ranking const &, Stop ) noexcept {}
+
+private:
+    PhaseTimer< false > timer_;
+};
+
+}
+
+}
+
+#endif // ECFCPP_METAHEURISTICS_GA_OBSERVER_HPP
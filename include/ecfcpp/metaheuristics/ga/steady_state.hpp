@@ -1,14 +1,214 @@
 #ifndef ECFCPP_METAHEURISTICS_GA_STEADY_STATE_HPP
 #define ECFCPP_METAHEURISTICS_GA_STEADY_STATE_HPP
 
+#include <ecfcpp/metaheuristics/ga/breed.hpp>
+#include <ecfcpp/metaheuristics/ga/evaluation.hpp>
+#include <ecfcpp/metaheuristics/ga/observer.hpp>
+#include <ecfcpp/ranking.hpp>
+#include <ecfcpp/selections/prepare.hpp>
+#include <ecfcpp/utils/random.hpp>
+
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <utility>
 
 namespace ecfcpp::ga
 {
 
+namespace detail
+{
+
+// Replaces mortalityRate part of the population with offspring of the rest.
+// Offspring is bred directly into the slot it replaces, recording changed genes
+// in the log of the slot, or just marking it stale if logs are StaleFlags,
+// unless logs are NoChangeLogs, and choices of adaptive operators in its
+// credit, unless credits are NoCredits. When parents are selected by index, a
+// logged slot first takes over the genes, score and log of a parent, so that
+// its log records just the genes breeding changes. Parents are selected using
+// ranking of the population at the start of the step. Time spent in every
+// phase is split on timer.
+template
+<
+    typename Selection,
+    typename Crossover,
+    typename Mutation,
+    typename Population,
+    typename Logs,
+    typename Credits,
+    typename Timer
+>
+void steadyStateStep
+(
+    float      const   mortalityRate,
+    Selection  const & selection,
+    Crossover  const & crossover,
+    Mutation   const & mutation,
+    Ranking    const & ranking,
+    Population       & population,
+    Logs             & logs,
+    Credits          & credits,
+    Timer            & timer
+)
+{
+    constexpr bool logChanges{ !std::is_same_v< Logs, NoChangeLogs > && !std::is_same_v< Logs, StaleFlags > };
+
+    auto && parents{ ecfcpp::selection::prepare( selection, population, ranking ) };
+    timer.lap( Phase::Selection );
+
+    auto const offspring
+    {
+        [ & ]( std::size_t const victim, auto const & mom, auto const & dad )
+        {
+            timer.lap( Phase::Selection );
+
+            auto && child{ population[ victim ] };
+
+            if constexpr ( !logChanges )
+            {
+                detail::mate( crossover, mutation, mom, dad, child, NoChangeLog{}, creditOf( credits, victim ), timer );
+                bound::repair( child );
+
+                if constexpr ( std::is_same_v< Logs, StaleFlags > )
+                {
+                    logs[ victim ].invalidate();
+                }
+            }
+            else
+            {
+                detail::mate( crossover, mutation, mom, dad, child, logs[ victim ], creditOf( credits, victim ), timer );
+                detail::repair( child, logs[ victim ] );
+            }
+
+            timer.lap( Phase::Replacement );
+        }
+    };
+
+    auto const count{ static_cast< std::size_t >( std::ceil( mortalityRate * std::size( population ) ) ) };
+
+    if constexpr ( ecfcpp::selection::hasSelect< decltype( parents ), Population > )
+    {
+        // Parents of all offspring are selected at once.
+        auto const & indices{ parentIndices( parents, population, 2 * count ) };
+        timer.lap( Phase::Selection );
+        for ( std::size_t j{ 0 }; j < count; ++j )
+        {
+            auto const victim{ random::uniform< std::size_t >( j, std::size( population ) ) };
+            auto const mom   { indices[ 2 * j     ] };
+            auto const dad   { indices[ 2 * j + 1 ] };
+
+            if constexpr ( logChanges )
+            {
+                // Dad may be the victim himself, in which case he stays as he
+                // is until crossover reads him.
+                auto const base{ victim == dad ? dad : mom };
+                if ( base != victim )
+                {
+                    population[ victim ] = population[ base ];
+                    logs      [ victim ] = logs      [ base ];
+                }
+            }
+
+            offspring( victim, std::as_const( population )[ mom ], std::as_const( population )[ dad ] );
+        }
+    }
+    else
+    {
+        for ( std::size_t j{ 0 }; j < count; ++j )
+        {
+            auto const victim{ random::uniform< std::size_t >( j, std::size( population ) ) };
+            offspring( victim, parents( std::as_const( population ) ), parents( std::as_const( population ) ) );
+        }
+    }
+}
+
+template< typename Selection, typename Crossover, typename Mutation, typename Population >
+void steadyStateStep
+(
+    float      const   mortalityRate,
+    Selection  const & selection,
+    Crossover  const & crossover,
+    Mutation   const & mutation,
+    Ranking    const & ranking,
+    Population       & population
+)
+{
+    NoChangeLogs        logs;
+    NoCredits           credits;
+    PhaseTimer< false > timer;
+    steadyStateStep( mortalityRate, selection, crossover, mutation, ranking, population, logs, credits, timer );
+}
+
+template
+<
+    typename Problem,
+    typename Selection,
+    typename Crossover,
+    typename Mutation,
+    typename Population,
+    typename Observer,
+    typename = std::enable_if_t< !std::is_arithmetic_v< std::decay_t< Observer > > >
+>
+[[ nodiscard ]] auto steady_state
+(
+    float       const   mortalityRate,
+    std::size_t const   maxGenerations,
+    double      const   desiredFitness,
+    double      const   precision,
+    Problem     const & problem,
+    Selection   const & selection,
+    Crossover   const & crossover,
+    Mutation    const & mutation,
+    Population  const & initialPopulation,
+    Observer          & observer
+)
+{
+    using Individual = typename Population::value_type;
+
+    auto population{ initialPopulation };
+    auto logs{ replacementLogs( problem, population ) };
+    auto credits{ detail::credits( crossover, mutation, population ) };
+    detail::reset( crossover, mutation );
+
+    Ranking ranking;
+
+    Observation< Observer > observation{ observer };
+
+    for ( std::size_t i{ 0 }; i < maxGenerations; ++i )
+    {
+        observation.evaluating( population, logs );
+        detail::evaluate( problem, population, logs );
+        detail::reward( crossover, mutation, population, credits );
+        ranking.update( population, rankedCount< Selection >( 1, population ) );
+
+        auto const & best{ population[ ranking.best() ] };
+        auto const   reached{ std::abs( best.fitness - desiredFitness ) <= precision };
+
+        observation.report( i, population, ranking, reached ? Stop::DesiredFitness : Stop::None );
+
+        if ( reached )
+        {
+            return Individual( best );
+        }
+
+        steadyStateStep( mortalityRate, selection, crossover, mutation, ranking, population, logs, credits, observation.timer() );
+    }
+
+    observation.evaluating( population, logs );
+    detail::evaluate( problem, population, logs );
+    ranking.update( population, 1 );
+    observation.report( maxGenerations, population, ranking, Stop::MaxGenerations );
+    return Individual( population[ ranking.best() ] );
+}
+
+}
+
+// Logs progress to standard output every logFrequency generations, unless it
+// is zero.
 template< typename Problem, typename Selection, typename Crossover, typename Mutation, typename Population >
 [[ nodiscard ]] constexpr auto steady_state
 (
@@ -24,51 +224,71 @@ template< typename Problem, typename Selection, typename Crossover, typename Mut
     std::uint16_t const   logFrequency = 0
 )
 {
-    auto population{ initialPopulation };
-
-    for ( std::size_t i{ 0 }; i < maxGenerations; ++i )
+    auto const run
     {
-        problem.evaluate( population );
-
-        auto const & best{ *std::max_element( std::begin( population ), std::end( population ) ) };
-
-        if ( logFrequency > 0 && i % logFrequency == 0 )
-        {
-            std::cout << "Generation #" << i << '\n'
-                      << "  Fitness  = " << best.fitness << '\n'
-                      << "  Solution = " << best << '\n' << '\n';
-        }
-
-        if ( std::abs( best.fitness - desiredFitness ) <= precision )
-        {
-            if ( logFrequency > 0 )
-            {
-                std::cout << "Reached desired fitness in generation #" << i << ".\n\n";
-            }
-            return best;
-        }
-
-        for ( std::size_t j{ 0 }; j < mortalityRate * std::size( population ); ++j )
+        [ & ]( auto && observer )
         {
-            auto x{ selection( population ) };
-            auto y{ selection( population ) };
-            population[ random::uniform< std::size_t >( j, std::size( population ) ) ] = mutation
-            ( 
-                crossover
-                (
-                    selection( population ),
-                    selection( population )
-                )[ 0 ]
+            return detail::steady_state
+            (
+                mortalityRate,
+                maxGenerations,
+                desiredFitness,
+                precision,
+                problem,
+                selection,
+                crossover,
+                mutation,
+                initialPopulation,
+                observer
             );
         }
-    }
+    };
 
     if ( logFrequency > 0 )
     {
-        std::cout << "Maximum generations reached.\n\n";
+        return run( observer::Log{ std::cout, logFrequency } );
     }
-    problem.evaluate( population );
-    return *std::max_element( std::begin( population ), std::end( population ) );
+    return run( observer::None{} );
+}
+
+// As above, reporting every generation to observer, see Generation.
+template
+<
+    typename Problem,
+    typename Selection,
+    typename Crossover,
+    typename Mutation,
+    typename Population,
+    typename Observer,
+    typename = std::enable_if_t< !std::is_arithmetic_v< std::decay_t< Observer > > >
+>
+[[ nodiscard ]] auto steady_state
+(
+    float       const   mortalityRate,
+    std::size_t const   maxGenerations,
+    double      const   desiredFitness,
+    double      const   precision,
+    Problem     const & problem,
+    Selection   const & selection,
+    Crossover   const & crossover,
+    Mutation    const & mutation,
+    Population  const & initialPopulation,
+    Observer         && observer
+)
+{
+    return detail::steady_state
+    (
+        mortalityRate,
+        maxGenerations,
+        desiredFitness,
+        precision,
+        problem,
+        selection,
+        crossover,
+        mutation,
+        initialPopulation,
+        observer
+    );
 }
 
 }
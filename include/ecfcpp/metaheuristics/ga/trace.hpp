@@ -0,0 +1,48 @@
+#ifndef ECFCPP_METAHEURISTICS_GA_TRACE_HPP
+#define ECFCPP_METAHEURISTICS_GA_TRACE_HPP
+
+#include <ecfcpp/metaheuristics/ga/observer.hpp>
+#include <ecfcpp/utils/trace.hpp>
+
+#include <chrono>
+#include <cstdint>
+
+namespace ecfcpp::ga::observer
+{
+
+// Pushes a trace::Record of every generation to writer, which writes it to its
+// file in the background. Diversity is the standard deviation of fitness in
+// the population; elapsed time is counted from construction of the observer.
+class Trace
+{
+public:
+    static constexpr bool timed{ false };
+
+    Trace( trace::Writer & writer ) noexcept : writer_{ writer } {}
+
+    template< typename Population >
+    void operator()( Generation< Population > const & generation ) const noexcept
+    {
+        auto const elapsed{ std::chrono::duration_cast< std::chrono::nanoseconds >( Clock::now() - start_ ) };
+
+        writer_.push
+        (
+            {
+                generation.index,
+                static_cast< std::uint64_t >( elapsed.count() ),
+                generation.fitness.best,
+                generation.fitness.deviation
+            }
+        );
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    trace::Writer   & writer_;
+    Clock::time_point start_{ Clock::now() };
+};
+
+}
+
+#endif // ECFCPP_METAHEURISTICS_GA_TRACE_HPP
@@ -1,2 +1,6 @@
+#include "ga/async_steady_state.hpp"
+#include "ga/checkpoint.hpp"
 #include "ga/generational.hpp"
-#include "ga/steady_state.hpp"
\ No newline at end of file
+#include "ga/island.hpp"
+#include "ga/steady_state.hpp"
+#include "ga/trace.hpp"
\ No newline at end of file
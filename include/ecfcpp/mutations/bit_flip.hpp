@@ -1,9 +1,17 @@
 #ifndef ECFCPP_MUTATIONS_BIT_FLIP_HPP
 #define ECFCPP_MUTATIONS_BIT_FLIP_HPP
 
+#include <ecfcpp/bit_vector.hpp>
+#include <ecfcpp/change_log.hpp>
+#include <ecfcpp/mutations/sampling.hpp>
 #include <ecfcpp/types.hpp>
 #include <ecfcpp/utils/random.hpp>
 
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
 namespace ecfcpp::mutation
 {
 
@@ -12,41 +20,93 @@ class BitFlip
 public:
     constexpr BitFlip
     (
-        float  const mutationProbability,
-        bool   const forceMutation
+        float    const mutationProbability,
+        bool     const forceMutation,
+        Sampling const sampling = Sampling::PerGene
     ) :
         mutationProbability_{ mutationProbability },
-        forceMutation_{ forceMutation }
+        forceMutation_{ forceMutation },
+        sampling_{ sampling }
     {}
 
     template< typename T >
-    constexpr T operator()( T const & individual ) const
+    constexpr individual_t< T > operator()( T const & individual ) const
     {
-        T mutant{ individual };
-        bool mutationHappened{ false };
+        individual_t< T > mutant{ individual };
+        apply( mutant );
+        return mutant;
+    }
 
-        for ( auto & value : mutant.data() )
+    // Mutates individual in place.
+    template< typename T >
+    constexpr void apply( T && individual ) const
+    {
+        apply( std::forward< T >( individual ), NoChangeLog{} );
+    }
+
+    // Mutates individual in place, recording genes it changes in log.
+    template< typename T, typename Log, typename = std::enable_if_t< isChangeLog< Log > > >
+    constexpr void apply( T && individual, Log && log ) const
+    {
+        // Genotype may hand out proxies to its bits, as packed bit vectors do.
+        auto && genes{ individual.data() };
+
+        bool mutationHappened{ false };
+        if constexpr
+        (
+            std::is_same_v< std::decay_t< decltype( genes ) >, BitVector > &&
+            std::is_same_v< std::decay_t< Log >, NoChangeLog >
+        )
         {
-            if ( random::uniform< decltype( mutationProbability_ ) >() < mutationProbability_ )
+            // Picked bits of a word are flipped together with a single mask.
+            auto * const         words{ genes.words() };
+            std::size_t          word { 0 };
+            BitVector::word_type mask { 0 };
+
+            mutationHappened = detail::forEachPicked
+            (
+                std::size( genes ),
+                mutationProbability_,
+                sampling_,
+                [ & ]( std::size_t const i )
+                {
+                    if ( i / BitVector::wordBits != word )
+                    {
+                        words[ word ] ^= mask;
+                        word = i / BitVector::wordBits;
+                        mask = 0;
+                    }
+                    mask |= BitVector::word_type{ 1 } << i % BitVector::wordBits;
+                }
+            );
+
+            if ( mutationHappened )
             {
-                mutationHappened = true;
-                value = !value;
+                words[ word ] ^= mask;
             }
         }
+        else
+        {
+            mutationHappened = detail::forEachPicked
+            (
+                std::size( genes ),
+                mutationProbability_,
+                sampling_,
+                [ & ]( std::size_t const i ) { log.write( genes[ i ], i, !genes[ i ] ); }
+            );
+        }
 
         if ( !mutationHappened && forceMutation_ )
         {
-            auto const randIndex{ random::uniform( 0UL, std::size( mutant.data() ) ) };
-            mutant.data()[ randIndex ] = !mutant.data()[ randIndex ];
+            auto const randIndex{ random::uniform( 0UL, std::size( genes ) ) };
+            log.write( genes[ randIndex ], randIndex, !genes[ randIndex ] );
         }
-
-        return mutant;
     }
 
     template< typename T >
-    constexpr Container< T > operator()( Container< T > const & individuals ) const
+    constexpr Container< individual_t< T > > operator()( Container< T > const & individuals ) const
     {
-        Container< T > mutants;
+        Container< individual_t< T > > mutants;
         mutants.reserve( std::size( individuals ) );
 
         for ( auto const & individual : individuals )
@@ -58,10 +118,11 @@ public:
     }
 
 private:
-    float mutationProbability_;
-    bool  forceMutation_;
+    float    mutationProbability_;
+    bool     forceMutation_;
+    Sampling sampling_;
 };
 
 }
 
-#endif // ECFCPP_MUTATIONS_GAUSSIAN_HPP
+#endif // ECFCPP_MUTATIONS_BIT_FLIP_HPP
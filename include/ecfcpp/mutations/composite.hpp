@@ -1,76 +1,80 @@
 #ifndef ECFCPP_MUTATIONS_COMPOSITE_HPP
 #define ECFCPP_MUTATIONS_COMPOSITE_HPP
 
+#include <ecfcpp/adaptive.hpp>
+#include <ecfcpp/change_log.hpp>
+#include <ecfcpp/mutations/in_place.hpp>
 #include <ecfcpp/types.hpp>
-#include <ecfcpp/utils/random.hpp>
+#include <ecfcpp/weighted.hpp>
 
 #include <cstddef>
-#include <cstdint>
-#include <functional>
-#include <initializer_list>
 #include <iterator>
-#include <numeric>
+#include <tuple>
+#include <type_traits>
 #include <utility>
-#include <vector>
 
 namespace ecfcpp::mutation
 {
 
-template< typename T >
+// Applies one of its mutations, chosen anew on every call with probability
+// proportional to its weight. Mutations are given as they are or wrapped in
+// Weighted, as in Composite{ Weighted{ gaussian, 1 }, Weighted{ bitFlip, 2 } }.
+// Given AdaptivePursuit first, weights only set the initial probabilities.
+template< typename... Mutations >
 class Composite
 {
 public:
-    using Mutation = std::function< T( T const & ) >;
-    using MutationDesirability = std::pair< Mutation, std::uint8_t >;
-
-    Composite
-    ( 
-        std::initializer_list< MutationDesirability > const & mutations
-    ) : 
-        mutations_{ mutations }
+    static_assert( sizeof...( Mutations ) > 0 );
+
+    template
+    <
+        typename... Args,
+        typename = std::enable_if_t< sizeof...( Args ) == sizeof...( Mutations ) && ( !std::is_same_v< std::decay_t< Args >, Composite > && ... ) >
+    >
+    constexpr Composite( Args const &... mutations ) :
+        mutations_{ ecfcpp::detail::unweighted( mutations )... },
+        choice_   { { { ecfcpp::detail::weightOf( mutations )... } } }
+    {}
+
+    // Adapts probabilities of choosing mutations to their success in the run.
+    template< typename... Args, typename = std::enable_if_t< sizeof...( Args ) == sizeof...( Mutations ) > >
+    constexpr Composite( AdaptivePursuit const & pursuit, Args const &... mutations ) :
+        mutations_{ ecfcpp::detail::unweighted( mutations )... },
+        choice_   { pursuit, { { ecfcpp::detail::weightOf( mutations )... } } }
+    {}
+
+    template< typename T >
+    constexpr individual_t< T > operator()( T const & individual ) const
     {
-        auto const desirabilitySum
-        {
-            std::accumulate
-            (
-                std::begin( mutations_ ),
-                std::end  ( mutations_ ),
-                static_cast< decimal_t >( 0 ),
-                []( auto const & current, auto const & mutation )
-                {
-                    return current + mutation.second;
-                }
-            )
-        };
-
-        chooseProbability_.reserve( std::size( mutations_ ) );
-
-        for ( auto const & mutation : mutations_ )
-        {
-            chooseProbability_.emplace_back( mutation.second / desirabilitySum );
-        }
+        individual_t< T > mutant{ individual };
+        apply( mutant );
+        return mutant;
     }
 
-    T operator()( T const & individual ) const
+    // Mutates individual in place.
+    template< typename T >
+    constexpr void apply( T && individual ) const
     {
-        auto const randomValue{ random::uniform< decimal_t >() };
-        decimal_t probabilitySum{ 0 };
+        choose( [ & ]( auto const & mutation ) { inPlace( mutation, std::forward< T >( individual ) ); } );
+    }
 
-        for ( auto const & mutation : mutations_ )
-        {
-            probabilitySum += mutation.second;
-            if ( randomValue < probabilitySum )
+    // Records genes the chosen mutation changes in log, if it can.
+    template< typename T, typename Log, typename = std::enable_if_t< isChangeLog< Log > > >
+    constexpr void apply( T && individual, Log && log ) const
+    {
+        choose
+        (
+            [ & ]( auto const & mutation )
             {
-                return mutation.first( individual );
+                inPlace( mutation, std::forward< T >( individual ), std::forward< Log >( log ) );
             }
-        }
-
-        return mutations_.back().first( individual );
+        );
     }
 
-    Container< T > operator()( Container< T > const & individuals ) const
+    template< typename T >
+    constexpr Container< individual_t< T > > operator()( Container< T > const & individuals ) const
     {
-        Container< T > mutants;
+        Container< individual_t< T > > mutants;
         mutants.reserve( std::size( individuals ) );
 
         for ( auto const & individual : individuals )
@@ -81,11 +85,53 @@ public:
         return mutants;
     }
 
+    // Index of a randomly chosen mutation. Engines choose and visit it themselves
+    // when they reward mutations for offspring they make.
+    inline std::size_t choose() const noexcept { return choice_.choose(); }
+
+    // Calls function with mutation number choice.
+    template< typename Function >
+    constexpr decltype( auto ) visit( std::size_t const choice, Function && function ) const
+    {
+        return ecfcpp::detail::visit( mutations_, choice, std::forward< Function >( function ) );
+    }
+
+    // Rewards and adaptation change probabilities of future choices. Engines
+    // call them between generations, never while offspring is being bred.
+    inline void reward( std::size_t const choice, double const improvement ) const noexcept
+    {
+        choice_.reward( choice, improvement );
+    }
+
+    inline void adapt() const noexcept { choice_.adapt(); }
+
+    // Restores the initial probabilities. Engines reset adaptive composites at
+    // the start of every run, so a composite used for several runs starts each
+    // of them afresh instead of from what earlier runs learned.
+    inline void reset() const noexcept { choice_.reset(); }
+
+    inline bool adaptive() const noexcept { return choice_.adaptive(); }
+
+    // Probability of choosing mutation number choice.
+    inline decimal_t probability( std::size_t const choice ) const noexcept { return choice_.probability( choice ); }
+
 private:
-    std::vector< decimal_t > chooseProbability_;
-    std::vector< MutationDesirability > mutations_;
+    template< typename Function >
+    constexpr decltype( auto ) choose( Function && function ) const
+    {
+        return visit( choose(), std::forward< Function >( function ) );
+    }
+
+    std::tuple< Mutations... >                                       mutations_;
+    mutable ecfcpp::detail::OperatorChoice< sizeof...( Mutations ) > choice_;
 };
 
+template< typename... Args >
+Composite( Args... ) -> Composite< ecfcpp::detail::unweighted_t< Args >... >;
+
+template< typename... Args >
+Composite( AdaptivePursuit, Args... ) -> Composite< ecfcpp::detail::unweighted_t< Args >... >;
+
 }
 
 #endif // ECFCPP_MUTATIONS_COMPOSITE_HPP
@@ -1,11 +1,16 @@
 #ifndef ECFCPP_MUTATIONS_GAUSSIAN_HPP
 #define ECFCPP_MUTATIONS_GAUSSIAN_HPP
 
+#include <ecfcpp/change_log.hpp>
+#include <ecfcpp/mutations/sampling.hpp>
 #include <ecfcpp/types.hpp>
 #include <ecfcpp/utils/random.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <iterator>
+#include <type_traits>
+#include <utility>
 
 namespace ecfcpp::mutation
 {
@@ -25,44 +30,65 @@ public:
         decimal_t const mutationProbability,
         bool      const forceMutation,
         decimal_t const sigma,
-        Type      const type = Type::Add
+        Type      const type     = Type::Add,
+        Sampling  const sampling = Sampling::PerGene
     ) :
         mutationProbability_{ mutationProbability },
         forceMutation_{ forceMutation },
         sigma_{ sigma },
-        type_{ type }
+        type_{ type },
+        sampling_{ sampling }
     {}
 
     template< typename T >
-    constexpr T operator()( T const & individual ) const
+    constexpr individual_t< T > operator()( T const & individual ) const
     {
-        T mutant{ individual };
-        bool mutationHappened{ false };
+        individual_t< T > mutant{ individual };
+        apply( mutant );
+        return mutant;
+    }
+
+    // Mutates individual in place.
+    template< typename T >
+    constexpr void apply( T && individual ) const
+    {
+        apply( std::forward< T >( individual ), NoChangeLog{} );
+    }
 
-        for ( auto & value : mutant.data() )
+    // Mutates individual in place, recording genes it changes in log.
+    template< typename T, typename Log, typename = std::enable_if_t< isChangeLog< Log > > >
+    constexpr void apply( T && individual, Log && log ) const
+    {
+        using value_type = typename std::remove_reference_t< T >::value_type;
+
+        auto && genes{ individual.data() };
+        auto const mutationHappened
         {
-            if ( random::uniform< decltype( mutationProbability_ ) >() < mutationProbability_ )
-            {
-                mutationHappened = true;
-                auto const randomValue{ random::normal< typename T::value_type >( 0.0f, sigma_ ) };
-                value = randomValue + ( type_ == Type::Set ? 0 : value );
-            }
-        }
+            detail::forEachPicked
+            (
+                std::size( genes ),
+                mutationProbability_,
+                sampling_,
+                [ & ]( std::size_t const i )
+                {
+                    auto const randomValue{ random::normal< value_type >( 0.0f, sigma_ ) };
+                    log.write( genes[ i ], i, randomValue + ( type_ == Type::Set ? 0 : genes[ i ] ) );
+                }
+            )
+        };
 
         if ( !mutationHappened && forceMutation_ )
         {
-            auto const randomIndex{ random::uniform( 0UL, std::size( mutant.data() ) ) };
-            auto const randomValue{ random::normal< typename T::value_type >( 0.0f, sigma_ ) };
-            mutant.data()[ randomIndex ] = randomValue + ( type_ == Type::Set ? 0 : mutant.data()[ randomIndex ] );
+            auto const randomIndex{ random::uniform( 0UL, std::size( genes ) ) };
+            auto const randomValue{ random::normal< value_type >( 0.0f, sigma_ ) };
+            log.write( genes[ randomIndex ], randomIndex, randomValue + ( type_ == Type::Set ? 0 : genes[ randomIndex ] ) );
         }
-
-        return mutant;
     }
 
     template< typename T >
-    constexpr Container< T > operator()( Container< T > const & individuals ) const
+    constexpr Container< individual_t< T > > operator()( Container< T > const & individuals ) const
     {
-        Container< T > mutants;
+        Container< individual_t< T > > mutants;
         mutants.reserve( std::size( individuals ) );
 
         for ( auto const & individual : individuals )
@@ -78,6 +104,7 @@ private:
     bool      forceMutation_;
     decimal_t sigma_;
     Type      type_;
+    Sampling  sampling_;
 };
 
 }
@@ -0,0 +1,66 @@
+#ifndef ECFCPP_MUTATIONS_IN_PLACE_HPP
+#define ECFCPP_MUTATIONS_IN_PLACE_HPP
+
+#include <type_traits>
+#include <utility>
+
+namespace ecfcpp::mutation
+{
+
+template< typename Mutation, typename Individual, typename = void >
+struct HasApply : std::false_type {};
+
+template< typename Mutation, typename Individual >
+struct HasApply
+<
+    Mutation,
+    Individual,
+    std::void_t< decltype( std::declval< Mutation const & >().apply( std::declval< Individual >() ) ) >
+> : std::true_type {};
+
+template< typename Mutation, typename Individual, typename Log, typename = void >
+struct HasLoggedApply : std::false_type {};
+
+template< typename Mutation, typename Individual, typename Log >
+struct HasLoggedApply
+<
+    Mutation,
+    Individual,
+    Log,
+    std::void_t< decltype( std::declval< Mutation const & >().apply( std::declval< Individual >(), std::declval< Log >() ) ) >
+> : std::true_type {};
+
+// Mutates individual. Mutations with mutation.apply( individual ) change it
+// directly, others return a mutant which is then copied back.
+template< typename Mutation, typename Individual >
+constexpr void inPlace( Mutation const & mutation, Individual && individual )
+{
+    if constexpr ( HasApply< Mutation, Individual && >::value )
+    {
+        mutation.apply( std::forward< Individual >( individual ) );
+    }
+    else
+    {
+        individual = mutation( individual );
+    }
+}
+
+// Mutates individual, recording genes it changes in log. Mutations which
+// cannot record them invalidate the log.
+template< typename Mutation, typename Individual, typename Log >
+constexpr void inPlace( Mutation const & mutation, Individual && individual, Log && log )
+{
+    if constexpr ( HasLoggedApply< Mutation, Individual &&, Log && >::value )
+    {
+        mutation.apply( std::forward< Individual >( individual ), std::forward< Log >( log ) );
+    }
+    else
+    {
+        log.invalidate();
+        inPlace( mutation, std::forward< Individual >( individual ) );
+    }
+}
+
+}
+
+#endif // ECFCPP_MUTATIONS_IN_PLACE_HPP
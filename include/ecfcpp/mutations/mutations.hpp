@@ -1,3 +1,5 @@
 #include "bit_flip.hpp"
 #include "composite.hpp"
 #include "gaussian.hpp"
+#include "in_place.hpp"
+#include "sampling.hpp"
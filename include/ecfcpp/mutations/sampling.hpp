@@ -0,0 +1,88 @@
+#ifndef ECFCPP_MUTATIONS_SAMPLING_HPP
+#define ECFCPP_MUTATIONS_SAMPLING_HPP
+
+#include <ecfcpp/utils/random.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace ecfcpp::mutation
+{
+
+// How a mutation picks genes it changes, each with the same probability.
+// PerGene draws a random number for every gene. Skip draws the distance to the
+// next picked gene from the geometric distribution, so its cost grows with the
+// number of picked genes instead of the length of the chromosome. Both pick
+// genes with the same distribution, but from different random numbers.
+enum class Sampling : std::uint8_t
+{
+    PerGene,
+    Skip
+};
+
+namespace detail
+{
+
+// Calls mutate( i ) for every picked gene i out of size, in increasing order.
+// Returns whether any gene was picked.
+template< typename Probability, typename Mutate >
+bool forEachPicked( std::size_t const size, Probability const probability, Sampling const sampling, Mutate && mutate )
+{
+    bool picked{ false };
+
+    if ( sampling == Sampling::PerGene )
+    {
+        auto const draws{ random::uniforms< Probability >( size ) };
+        for ( std::size_t i{ 0 }; i < size; ++i )
+        {
+            if ( draws[ i ] < probability )
+            {
+                picked = true;
+                mutate( i );
+            }
+        }
+        return picked;
+    }
+
+    if ( probability <= 0 )
+    {
+        return false;
+    }
+
+    if ( probability >= 1 )
+    {
+        for ( std::size_t i{ 0 }; i < size; ++i )
+        {
+            mutate( i );
+        }
+        return size > 0;
+    }
+
+    // Number of genes skipped before the next picked one is the floor of
+    // log( u ) / log( 1 - probability ) for u uniform from ( 0, 1 ].
+    auto const scale{ 1 / std::log1p( -static_cast< double >( probability ) ) };
+    auto const gap
+    {
+        [ scale, size ]
+        {
+            auto const skipped{ std::log( 1 - random::uniform< double >() ) * scale };
+            return static_cast< std::size_t >( std::min( skipped, static_cast< double >( size ) ) );
+        }
+    };
+
+    for ( std::size_t i{ gap() }; i < size; i += 1 + gap() )
+    {
+        picked = true;
+        mutate( i );
+    }
+
+    return picked;
+}
+
+}
+
+}
+
+#endif // ECFCPP_MUTATIONS_SAMPLING_HPP
@@ -0,0 +1,466 @@
+#ifndef ECFCPP_POPULATIONS_ARRAY_POPULATION_HPP
+#define ECFCPP_POPULATIONS_ARRAY_POPULATION_HPP
+
+#include <ecfcpp/bounds.hpp>
+#include <ecfcpp/chromosomes/array.hpp>
+#include <ecfcpp/constants.hpp>
+#include <ecfcpp/types.hpp>
+#include <ecfcpp/utils/aligned_allocator.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ecfcpp
+{
+
+// Population of Array chromosomes stored as structure of arrays.
+//
+// Genes form a N x P matrix in which gene k of all P individuals is a single
+// contiguous row, aligned to a cache line. Fitness and penalty are stored in
+// separate columns. Individuals are accessed through lightweight views which
+// selections, crossovers, mutations and problems accept in place of an Array;
+// a standalone Array is obtained by converting a view to individual_type.
+template
+<
+    typename    T,
+    std::size_t N,
+    typename    Decimal = std::conditional_t< std::is_floating_point_v< T >, T, decimal_t >,
+    typename    Bound   = bound::Clamp,
+    typename =  std::enable_if_t< std::is_arithmetic_v< T > >
+>
+class ArrayPopulation
+{
+public:
+    static constexpr std::size_t alignment{ 64 };
+
+    using value_type      = Array< T, N, Decimal, Bound >;
+    using gene_type       = T;
+    using decimal_t       = Decimal;
+    using bound_type      = Bound;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    template< typename Value >
+    class GeneIterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = std::remove_const_t< Value >;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = Value *;
+        using reference         = Value &;
+
+        constexpr GeneIterator() noexcept = default;
+
+        constexpr GeneIterator( pointer const gene, difference_type const stride ) noexcept :
+            gene_  { gene   },
+            stride_{ stride }
+        {}
+
+        constexpr inline reference operator* () const noexcept { return *gene_;  }
+        constexpr inline pointer   operator->() const noexcept { return  gene_;  }
+
+        constexpr inline reference operator[]( difference_type const n ) const noexcept { return gene_[ n * stride_ ]; }
+
+        constexpr inline GeneIterator & operator++()    noexcept { gene_ += stride_; return *this; }
+        constexpr inline GeneIterator & operator--()    noexcept { gene_ -= stride_; return *this; }
+        constexpr inline GeneIterator   operator++( int ) noexcept { auto copy{ *this }; ++*this; return copy; }
+        constexpr inline GeneIterator   operator--( int ) noexcept { auto copy{ *this }; --*this; return copy; }
+
+        constexpr inline GeneIterator & operator+=( difference_type const n ) noexcept { gene_ += n * stride_; return *this; }
+        constexpr inline GeneIterator & operator-=( difference_type const n ) noexcept { gene_ -= n * stride_; return *this; }
+
+        constexpr inline GeneIterator operator+( difference_type const n ) const noexcept { return { gene_ + n * stride_, stride_ }; }
+        constexpr inline GeneIterator operator-( difference_type const n ) const noexcept { return { gene_ - n * stride_, stride_ }; }
+
+        constexpr inline difference_type operator-( GeneIterator const & rhs ) const noexcept { return ( gene_ - rhs.gene_ ) / stride_; }
+
+        constexpr inline bool operator==( GeneIterator const & rhs ) const noexcept { return gene_ == rhs.gene_; }
+        constexpr inline bool operator!=( GeneIterator const & rhs ) const noexcept { return gene_ != rhs.gene_; }
+        constexpr inline bool operator< ( GeneIterator const & rhs ) const noexcept { return gene_ <  rhs.gene_; }
+        constexpr inline bool operator> ( GeneIterator const & rhs ) const noexcept { return gene_ >  rhs.gene_; }
+        constexpr inline bool operator<=( GeneIterator const & rhs ) const noexcept { return gene_ <= rhs.gene_; }
+        constexpr inline bool operator>=( GeneIterator const & rhs ) const noexcept { return gene_ >= rhs.gene_; }
+
+    private:
+        pointer         gene_  { nullptr };
+        difference_type stride_{ 1       };
+    };
+
+    // View of an individual. Copying a view copies the reference, assigning to it
+    // copies genes, fitness and penalty into the population.
+    template< bool Const >
+    class Reference
+    {
+    public:
+        using value_type      = T;
+        using decimal_t       = Decimal;
+        using individual_type = Array< T, N, Decimal, Bound >;
+        using iterator        = GeneIterator< std::conditional_t< Const, T const, T > >;
+        using const_iterator  = GeneIterator< T const >;
+
+        constexpr Reference
+        (
+            typename iterator::pointer const         genes,
+            std::ptrdiff_t                 const     stride,
+            value_type                     const     lowerBound,
+            value_type                     const     upperBound,
+            std::conditional_t< Const, decimal_t const, decimal_t > & fitness,
+            std::conditional_t< Const, decimal_t const, decimal_t > & penalty
+        ) noexcept :
+            fitness    { fitness    },
+            penalty    { penalty    },
+            genes_     { genes      },
+            stride_    { stride     },
+            lowerBound_{ lowerBound },
+            upperBound_{ upperBound }
+        {}
+
+        constexpr Reference( Reference const & other ) noexcept = default;
+
+        template< bool OtherConst, typename = std::enable_if_t< Const && !OtherConst > >
+        constexpr Reference( Reference< OtherConst > const & other ) noexcept :
+            Reference{ other.genes_, other.stride_, other.lowerBound_, other.upperBound_, other.fitness, other.penalty }
+        {}
+
+        constexpr Reference & operator=( Reference const & rhs )
+        {
+            static_assert( !Const );
+            return assign( rhs );
+        }
+
+        template< bool OtherConst >
+        constexpr Reference & operator=( Reference< OtherConst > const & rhs )
+        {
+            static_assert( !Const );
+            return assign( rhs );
+        }
+
+        constexpr Reference & operator=( individual_type const & rhs )
+        {
+            static_assert( !Const );
+            return assign( rhs );
+        }
+
+        constexpr operator individual_type() const
+        {
+            individual_type individual{ lowerBound_, upperBound_ };
+            for ( std::size_t i{ 0 }; i < N; ++i )
+            {
+                individual[ i ] = ( *this )[ i ];
+            }
+            individual.fitness = fitness;
+            individual.penalty = penalty;
+            return individual;
+        }
+
+        constexpr inline value_type operator[]( std::size_t const index ) const noexcept
+        {
+            assert( index < N );
+            return genes_[ static_cast< std::ptrdiff_t >( index ) * stride_ ];
+        }
+
+        constexpr inline typename iterator::reference operator[]( std::size_t const index ) noexcept
+        {
+            assert( index < N );
+            return genes_[ static_cast< std::ptrdiff_t >( index ) * stride_ ];
+        }
+
+        template< bool OtherConst >
+        constexpr inline bool operator< ( Reference< OtherConst > const & rhs ) const { return fitness < rhs.fitness; }
+        template< bool OtherConst >
+        constexpr inline bool operator> ( Reference< OtherConst > const & rhs ) const { return rhs < *this;           }
+        template< bool OtherConst >
+        constexpr inline bool operator<=( Reference< OtherConst > const & rhs ) const { return !( *this > rhs );      }
+        template< bool OtherConst >
+        constexpr inline bool operator>=( Reference< OtherConst > const & rhs ) const { return !( rhs > *this );      }
+
+        template< bool OtherConst >
+        constexpr inline bool operator==( Reference< OtherConst > const & rhs ) const
+        {
+            return std::equal( begin(), end(), rhs.begin() );
+        }
+
+        template< bool OtherConst >
+        constexpr inline bool operator!=( Reference< OtherConst > const & rhs ) const { return !( *this == rhs ); }
+
+        friend std::ostream & operator<<( std::ostream & stream, Reference const & reference )
+        {
+            stream << '{';
+
+            char separator[]{ '\0', ' ', '\0' };
+            for ( auto const value : reference )
+            {
+                stream << separator << value;
+                separator[ 0 ] = ',';
+            }
+
+            stream << '}';
+
+            return stream;
+        }
+
+        // Genes are accessed through the view itself.
+        constexpr inline Reference data() const noexcept { return *this; }
+
+        constexpr inline auto size() const noexcept { return N; }
+
+        constexpr inline auto lowerBound() const noexcept { return lowerBound_; }
+        constexpr inline auto upperBound() const noexcept { return upperBound_; }
+
+        // Brings genes back into bounds. Repairing a range of the population
+        // at once is faster.
+        constexpr inline void repair() const
+        {
+            static_assert( !Const );
+            Bound{}( begin(), end(), lowerBound_, upperBound_ );
+        }
+
+        constexpr inline void repair( std::size_t const index ) const
+        {
+            static_assert( !Const );
+            assert( index < N );
+            auto const gene{ begin() + static_cast< std::ptrdiff_t >( index ) };
+            Bound{}( gene, gene + 1, lowerBound_, upperBound_ );
+        }
+
+        constexpr inline iterator begin() const noexcept { return { genes_, stride_ }; }
+        constexpr inline iterator end  () const noexcept { return { genes_ + static_cast< std::ptrdiff_t >( N ) * stride_, stride_ }; }
+
+        std::conditional_t< Const, decimal_t const, decimal_t > & fitness;
+        std::conditional_t< Const, decimal_t const, decimal_t > & penalty;
+
+    private:
+        template< bool > friend class Reference;
+
+        template< typename Individual >
+        constexpr Reference & assign( Individual const & rhs )
+        {
+            for ( std::size_t i{ 0 }; i < N; ++i )
+            {
+                genes_[ static_cast< std::ptrdiff_t >( i ) * stride_ ] = rhs[ i ];
+            }
+            fitness = rhs.fitness;
+            penalty = rhs.penalty;
+            return *this;
+        }
+
+        typename iterator::pointer genes_;
+        std::ptrdiff_t             stride_;
+        value_type                 lowerBound_;
+        value_type                 upperBound_;
+    };
+
+    using reference       = Reference< false >;
+    using const_reference = Reference< true  >;
+
+    template< typename Population, typename View >
+    class Iterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = ArrayPopulation::value_type;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = View;
+
+        constexpr Iterator() noexcept = default;
+
+        constexpr Iterator( Population * const population, std::size_t const index ) noexcept :
+            population_{ population },
+            index_     { index      }
+        {}
+
+        constexpr inline reference operator*() const noexcept { return ( *population_ )[ index_ ]; }
+
+        constexpr inline reference operator[]( difference_type const n ) const noexcept { return *( *this + n ); }
+
+        constexpr inline Iterator & operator++()      noexcept { ++index_; return *this; }
+        constexpr inline Iterator & operator--()      noexcept { --index_; return *this; }
+        constexpr inline Iterator   operator++( int ) noexcept { auto copy{ *this }; ++index_; return copy; }
+        constexpr inline Iterator   operator--( int ) noexcept { auto copy{ *this }; --index_; return copy; }
+
+        constexpr inline Iterator & operator+=( difference_type const n ) noexcept { index_ = static_cast< std::size_t >( static_cast< difference_type >( index_ ) + n ); return *this; }
+        constexpr inline Iterator & operator-=( difference_type const n ) noexcept { return *this += -n; }
+
+        constexpr inline Iterator operator+( difference_type const n ) const noexcept { auto copy{ *this }; return copy += n; }
+        constexpr inline Iterator operator-( difference_type const n ) const noexcept { auto copy{ *this }; return copy -= n; }
+
+        constexpr inline difference_type operator-( Iterator const & rhs ) const noexcept
+        {
+            return static_cast< difference_type >( index_ ) - static_cast< difference_type >( rhs.index_ );
+        }
+
+        constexpr inline bool operator==( Iterator const & rhs ) const noexcept { return index_ == rhs.index_; }
+        constexpr inline bool operator!=( Iterator const & rhs ) const noexcept { return index_ != rhs.index_; }
+        constexpr inline bool operator< ( Iterator const & rhs ) const noexcept { return index_ <  rhs.index_; }
+        constexpr inline bool operator> ( Iterator const & rhs ) const noexcept { return index_ >  rhs.index_; }
+        constexpr inline bool operator<=( Iterator const & rhs ) const noexcept { return index_ <= rhs.index_; }
+        constexpr inline bool operator>=( Iterator const & rhs ) const noexcept { return index_ >= rhs.index_; }
+
+    private:
+        Population * population_{ nullptr };
+        std::size_t  index_     { 0       };
+    };
+
+    using iterator       = Iterator< ArrayPopulation,       reference       >;
+    using const_iterator = Iterator< ArrayPopulation const, const_reference >;
+
+    ArrayPopulation() = default;
+
+    ArrayPopulation
+    (
+        std::size_t const size,
+        gene_type   const lowerBound,
+        gene_type   const upperBound
+    ) :
+        lowerBound_{ lowerBound                      },
+        upperBound_{ upperBound                      },
+        size_      { size                            },
+        stride_    { paddedSize( size )              },
+        genes_     ( N * stride_, std::clamp( gene_type{}, lowerBound, upperBound ) ),
+        fitness_   ( size, constant::worstFitness< decimal_t >() ),
+        penalty_   ( size, constant::worstPenalty< decimal_t >() )
+    {
+        assert( lowerBound_ <= upperBound_ );
+    }
+
+    // Population of size copies of individual, in the manner of std::vector.
+    ArrayPopulation( std::size_t const size, value_type const & individual ) :
+        ArrayPopulation{ size, boundsOf( individual ).first, boundsOf( individual ).second }
+    {
+        for ( auto && slot : *this )
+        {
+            slot = individual;
+        }
+    }
+
+    template
+    <
+        typename Iterator,
+        typename = typename std::iterator_traits< Iterator >::iterator_category
+    >
+    ArrayPopulation( Iterator const first, Iterator const last ) :
+        ArrayPopulation{ static_cast< std::size_t >( std::distance( first, last ) ), boundsOf( first, last ).first, boundsOf( first, last ).second }
+    {
+        std::copy( first, last, begin() );
+    }
+
+    explicit ArrayPopulation( Population< value_type > const & population ) :
+        ArrayPopulation{ std::begin( population ), std::end( population ) }
+    {}
+
+    constexpr inline reference operator[]( std::size_t const index ) noexcept
+    {
+        assert( index < size_ );
+        return
+        {
+            genes_.data() + index, static_cast< std::ptrdiff_t >( stride_ ),
+            lowerBound_, upperBound_,
+            fitness_[ index ], penalty_[ index ]
+        };
+    }
+
+    constexpr inline const_reference operator[]( std::size_t const index ) const noexcept
+    {
+        assert( index < size_ );
+        return
+        {
+            genes_.data() + index, static_cast< std::ptrdiff_t >( stride_ ),
+            lowerBound_, upperBound_,
+            fitness_[ index ], penalty_[ index ]
+        };
+    }
+
+    constexpr inline reference       front()       noexcept { return ( *this )[ 0 ]; }
+    constexpr inline const_reference front() const noexcept { return ( *this )[ 0 ]; }
+
+    constexpr inline reference       back()       noexcept { return ( *this )[ size_ - 1 ]; }
+    constexpr inline const_reference back() const noexcept { return ( *this )[ size_ - 1 ]; }
+
+    constexpr inline auto size () const noexcept { return size_;      }
+    constexpr inline auto empty() const noexcept { return size_ == 0; }
+
+    // Number of genes of every individual.
+    static constexpr inline std::size_t dimension() noexcept { return N; }
+
+    // Distance in elements between consecutive gene rows.
+    constexpr inline auto stride() const noexcept { return stride_; }
+
+    constexpr inline auto lowerBound() const noexcept { return lowerBound_; }
+    constexpr inline auto upperBound() const noexcept { return upperBound_; }
+
+    // Gene index of all individuals, aligned to a cache line.
+    constexpr inline gene_type       * row( std::size_t const index )       noexcept { return genes_.data() + index * stride_; }
+    constexpr inline gene_type const * row( std::size_t const index ) const noexcept { return genes_.data() + index * stride_; }
+
+    // Brings genes of individuals [begin, end) back into bounds, one gene
+    // row at a time.
+    void repair( std::size_t const begin, std::size_t const end )
+    {
+        assert( begin <= end && end <= size_ );
+        for ( std::size_t i{ 0 }; i < N; ++i )
+        {
+            Bound{}( row( i ) + begin, row( i ) + end, lowerBound_, upperBound_ );
+        }
+    }
+
+    constexpr inline decimal_t       * fitnesses()       noexcept { return fitness_.data(); }
+    constexpr inline decimal_t const * fitnesses() const noexcept { return fitness_.data(); }
+
+    constexpr inline decimal_t       * penalties()       noexcept { return penalty_.data(); }
+    constexpr inline decimal_t const * penalties() const noexcept { return penalty_.data(); }
+
+    constexpr inline iterator begin() noexcept { return { this, 0     }; }
+    constexpr inline iterator end  () noexcept { return { this, size_ }; }
+
+    constexpr inline const_iterator begin() const noexcept { return { this, 0     }; }
+    constexpr inline const_iterator end  () const noexcept { return { this, size_ }; }
+
+private:
+    static constexpr std::size_t paddedSize( std::size_t const size ) noexcept
+    {
+        constexpr std::size_t perLine{ alignment / sizeof( gene_type ) };
+        return ( size + perLine - 1 ) / perLine * perLine;
+    }
+
+    template< typename Individual >
+    static constexpr std::pair< gene_type, gene_type > boundsOf( Individual const & individual ) noexcept
+    {
+        if constexpr ( std::is_same_v< individual_t< Individual >, Individual > )
+        {
+            return { individual.data().lowerBound(), individual.data().upperBound() };
+        }
+        else
+        {
+            return { individual.lowerBound(), individual.upperBound() };
+        }
+    }
+
+    // Bounds of the first individual of a range, or those of a default
+    // population if the range is empty.
+    template< typename Iterator >
+    static constexpr std::pair< gene_type, gene_type > boundsOf( Iterator const first, Iterator const last )
+    {
+        return first == last ? std::pair< gene_type, gene_type >{} : boundsOf( *first );
+    }
+
+    gene_type   lowerBound_{};
+    gene_type   upperBound_{};
+    std::size_t size_      { 0 };
+    std::size_t stride_    { 0 };
+
+    std::vector< gene_type, AlignedAllocator< gene_type, alignment > > genes_;
+    std::vector< decimal_t, AlignedAllocator< decimal_t, alignment > > fitness_;
+    std::vector< decimal_t, AlignedAllocator< decimal_t, alignment > > penalty_;
+};
+
+}
+
+#endif // ECFCPP_POPULATIONS_ARRAY_POPULATION_HPP
@@ -0,0 +1 @@
+#include "array_population.hpp"
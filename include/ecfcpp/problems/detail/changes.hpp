@@ -0,0 +1,92 @@
+#ifndef ECFCPP_PROBLEMS_DETAIL_CHANGES_HPP
+#define ECFCPP_PROBLEMS_DETAIL_CHANGES_HPP
+
+#include <ecfcpp/change_log.hpp>
+#include <ecfcpp/utils/thread_pool.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace ecfcpp::problem::detail
+{
+
+// Evaluates individuals of population whose logs, logs[ i ] for individual i,
+// show changes since their scores were computed. Scores of individuals with
+// updatable logs are changed by update( individual, delta ) when function
+// supports delta evaluation; the rest are evaluated by evaluateRange( begin,
+// end ), which is called with the longest runs of them.
+template< typename Function, typename Population, typename Logs, typename EvaluateRange, typename Update >
+void evaluateChanges
+(
+    Function             const & function,
+    parallel::ThreadPool *       threadPool,
+    std::size_t          const   chunkSize,
+    Population                 & population,
+    Logs                       & logs,
+    EvaluateRange        const & evaluateRange,
+    Update               const & update
+)
+{
+    using Individual = std::decay_t< decltype( population[ 0 ] ) >;
+
+    auto const evaluateChunk
+    {
+        [ & ]( std::size_t const begin, std::size_t const end )
+        {
+            auto const evaluateRun
+            {
+                [ & ]( std::size_t const runBegin, std::size_t const runEnd )
+                {
+                    if ( runBegin < runEnd )
+                    {
+                        evaluateRange( runBegin, runEnd );
+                        for ( std::size_t i{ runBegin }; i < runEnd; ++i )
+                        {
+                            logs[ i ].reset();
+                        }
+                    }
+                }
+            };
+
+            std::size_t runBegin{ begin };
+            for ( std::size_t i{ begin }; i < end; ++i )
+            {
+                auto & log{ logs[ i ] };
+
+                if ( log.unchanged() )
+                {
+                    evaluateRun( runBegin, i );
+                    runBegin = i + 1;
+                }
+                else if constexpr ( isDeltaFunction< Function, Individual > )
+                {
+                    if ( log.updatable() )
+                    {
+                        evaluateRun( runBegin, i );
+                        runBegin = i + 1;
+
+                        auto && individual{ population[ i ] };
+                        update( individual, function.delta( std::as_const( individual ), log.changes() ) );
+                        log.commit();
+                    }
+                }
+            }
+            evaluateRun( runBegin, end );
+        }
+    };
+
+    if ( threadPool == nullptr )
+    {
+        evaluateChunk( 0, std::size( population ) );
+    }
+    else
+    {
+        threadPool->forEachChunk( std::size( population ), chunkSize, evaluateChunk );
+    }
+}
+
+}
+
+#endif // ECFCPP_PROBLEMS_DETAIL_CHANGES_HPP
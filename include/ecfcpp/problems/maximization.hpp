@@ -1,6 +1,15 @@
 #ifndef ECFCPP_PROBLEMS_MAXIMIZATION_HPP
 #define ECFCPP_PROBLEMS_MAXIMIZATION_HPP
 
+#include <ecfcpp/problems/detail/changes.hpp>
+#include <ecfcpp/types.hpp>
+#include <ecfcpp/utils/thread_pool.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
 namespace ecfcpp::problem
 {
 
@@ -8,8 +17,22 @@ template< typename Function >
 class Maximization
 {
 public:
+    using function_type = Function;
+
     constexpr Maximization( Function const & function ) : function_{ function } {};
 
+    // Evaluates populations on the given thread pool, chunkSize individuals at a time.
+    constexpr Maximization
+    (
+        Function           const & function,
+        parallel::ThreadPool     & threadPool,
+        std::size_t        const   chunkSize = 0
+    ) :
+        function_  { function    },
+        threadPool_{ &threadPool },
+        chunkSize_ { chunkSize   }
+    {}
+
     template< typename Point >
     constexpr inline double fitness( Point const & p ) const { return function_( p ); }
 
@@ -21,15 +44,78 @@ public:
     template< typename Population >
     constexpr void evaluate( Population & population ) const
     {
-        for ( auto & individual : population )
+        auto const evaluateChunk
+        {
+            [ this, & population ]( std::size_t const begin, std::size_t const end ){ evaluateRange( population, begin, end ); }
+        };
+
+        if ( threadPool_ == nullptr )
         {
-            individual.fitness = fitness( individual         );
-            individual.penalty = penalty( individual.fitness );
+            evaluateChunk( 0, std::size( population ) );
         }
+        else
+        {
+            threadPool_->forEachChunk( std::size( population ), chunkSize_, evaluateChunk );
+        }
+    }
+
+    // Evaluates only individuals which changed since their last evaluation,
+    // according to their change logs, logs[ i ] for individual i. Scores are
+    // updated from the changes when the function supports it, see ChangeLog.
+    template< typename Population, typename Logs >
+    void evaluate( Population & population, Logs & logs ) const
+    {
+        detail::evaluateChanges
+        (
+            function_,
+            threadPool_,
+            chunkSize_,
+            population,
+            logs,
+            [ this, & population ]( std::size_t const begin, std::size_t const end ){ evaluateRange( population, begin, end ); },
+            [ this ]( auto && individual, double const delta )
+            {
+                individual.fitness += delta;
+                individual.penalty = penalty( individual.fitness );
+            }
+        );
     }
 
 private:
+    // Evaluates individuals [begin, end) of population.
+    template< typename Population >
+    constexpr void evaluateRange( Population & population, std::size_t const begin, std::size_t const end ) const
+    {
+        if constexpr ( isBatchFunction< Function, Population > )
+        {
+            auto * const fitnesses{ population.fitnesses() };
+            auto * const penalties{ population.penalties() };
+
+            function_( std::as_const( population ), begin, end, fitnesses );
+            for ( std::size_t i{ begin }; i < end; ++i )
+            {
+                penalties[ i ] = penalty( fitnesses[ i ] );
+            }
+        }
+        else
+        {
+            for ( std::size_t i{ begin }; i < end; ++i )
+            {
+                evaluateIndividual( population[ i ] );
+            }
+        }
+    }
+
+    template< typename Individual >
+    constexpr inline void evaluateIndividual( Individual && individual ) const
+    {
+        individual.fitness = fitness( individual         );
+        individual.penalty = penalty( individual.fitness );
+    }
+
     Function const & function_;
+    parallel::ThreadPool * threadPool_{ nullptr };
+    std::size_t            chunkSize_ { 0       };
 };
 
 }
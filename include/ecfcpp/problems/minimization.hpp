@@ -1,7 +1,14 @@
 #ifndef ECFCPP_PROBLEMS_MINIMIZATION_HPP
 #define ECFCPP_PROBLEMS_MINIMIZATION_HPP
 
+#include <ecfcpp/problems/detail/changes.hpp>
+#include <ecfcpp/types.hpp>
+#include <ecfcpp/utils/thread_pool.hpp>
+
+#include <cstddef>
+#include <iterator>
 #include <type_traits>
+#include <utility>
 
 namespace ecfcpp::problem
 {
@@ -10,8 +17,22 @@ template< typename Function >
 class Minimization
 {
 public:
+    using function_type = Function;
+
     constexpr Minimization( Function const & function ) : function_{ function } {};
 
+    // Evaluates populations on the given thread pool, chunkSize individuals at a time.
+    constexpr Minimization
+    (
+        Function           const & function,
+        parallel::ThreadPool     & threadPool,
+        std::size_t        const   chunkSize = 0
+    ) :
+        function_  { function    },
+        threadPool_{ &threadPool },
+        chunkSize_ { chunkSize   }
+    {}
+
     constexpr inline double fitness( double const penalty ) const { return -1 * penalty; }
 
     template< typename Point, typename = std::enable_if_t< !std::is_floating_point_v< Point > >  >
@@ -23,15 +44,78 @@ public:
     template< typename Population >
     constexpr void evaluate( Population & population ) const
     {
-        for ( auto & individual : population )
+        auto const evaluateChunk
         {
-            individual.penalty = penalty( individual         );
-            individual.fitness = fitness( individual.penalty );
+            [ this, & population ]( std::size_t const begin, std::size_t const end ){ evaluateRange( population, begin, end ); }
+        };
+
+        if ( threadPool_ == nullptr )
+        {
+            evaluateChunk( 0, std::size( population ) );
+        }
+        else
+        {
+            threadPool_->forEachChunk( std::size( population ), chunkSize_, evaluateChunk );
         }
     }
 
+    // Evaluates only individuals which changed since their last evaluation,
+    // according to their change logs, logs[ i ] for individual i. Scores are
+    // updated from the changes when the function supports it, see ChangeLog.
+    template< typename Population, typename Logs >
+    void evaluate( Population & population, Logs & logs ) const
+    {
+        detail::evaluateChanges
+        (
+            function_,
+            threadPool_,
+            chunkSize_,
+            population,
+            logs,
+            [ this, & population ]( std::size_t const begin, std::size_t const end ){ evaluateRange( population, begin, end ); },
+            [ this ]( auto && individual, double const delta )
+            {
+                individual.penalty += delta;
+                individual.fitness = fitness( individual.penalty );
+            }
+        );
+    }
+
 private:
+    // Evaluates individuals [begin, end) of population.
+    template< typename Population >
+    constexpr void evaluateRange( Population & population, std::size_t const begin, std::size_t const end ) const
+    {
+        if constexpr ( isBatchFunction< Function, Population > )
+        {
+            auto * const penalties{ population.penalties() };
+            auto * const fitnesses{ population.fitnesses() };
+
+            function_( std::as_const( population ), begin, end, penalties );
+            for ( std::size_t i{ begin }; i < end; ++i )
+            {
+                fitnesses[ i ] = fitness( penalties[ i ] );
+            }
+        }
+        else
+        {
+            for ( std::size_t i{ begin }; i < end; ++i )
+            {
+                evaluateIndividual( population[ i ] );
+            }
+        }
+    }
+
+    template< typename Individual >
+    constexpr inline void evaluateIndividual( Individual && individual ) const
+    {
+        individual.penalty = penalty( individual         );
+        individual.fitness = fitness( individual.penalty );
+    }
+
     Function const & function_;
+    parallel::ThreadPool * threadPool_{ nullptr };
+    std::size_t            chunkSize_ { 0       };
 };
 
 }
@@ -0,0 +1,123 @@
+#ifndef ECFCPP_RANKING_HPP
+#define ECFCPP_RANKING_HPP
+
+#include <ecfcpp/span.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+namespace ecfcpp
+{
+
+// Summary of an evaluated population, computed in one pass per generation and
+// shared by engines and selections: individuals ordered from the best to the
+// worst, best and worst individual, and fitness sums. Individuals themselves
+// are never moved, only their indices. Ties are broken by index, so the first
+// of equally fit individuals ranks higher.
+class Ranking
+{
+public:
+    Ranking() = default;
+
+    // Ranks all individuals of population.
+    template< typename Population >
+    void update( Population const & population )
+    {
+        update( population, std::size( population ) );
+    }
+
+    // Ranks population, putting only the best sorted individuals in order.
+    // The rest follow them in unspecified order, which is faster when only a
+    // few best ones are needed, as for elitism.
+    template< typename Population >
+    void update( Population const & population, std::size_t const sorted )
+    {
+        auto const size{ std::size( population ) };
+
+        fitness_   .resize( size );
+        cumulative_.resize( size );
+        order_     .resize( size );
+
+        double sum{ 0 };
+        for ( std::size_t i{ 0 }; i < size; ++i )
+        {
+            fitness_   [ i ] = population[ i ].fitness;
+            sum             += fitness_[ i ];
+            cumulative_[ i ] = sum;
+        }
+
+        std::iota( std::begin( order_ ), std::end( order_ ), std::size_t{ 0 } );
+        // Best individual is always known.
+        sorted_ = std::min( std::max( sorted, std::size_t{ 1 } ), size );
+
+        auto const better
+        {
+            [ this ]( std::size_t const lhs, std::size_t const rhs )
+            {
+                return fitness_[ lhs ] > fitness_[ rhs ] || ( fitness_[ lhs ] == fitness_[ rhs ] && lhs < rhs );
+            }
+        };
+
+        if ( sorted_ == size )
+        {
+            std::sort( std::begin( order_ ), std::end( order_ ), better );
+            worst_ = size > 0 ? order_.back() : 0;
+        }
+        else
+        {
+            // Indices are still in order, so the worst is found without
+            // sorting the rest.
+            worst_ = *std::max_element( std::begin( order_ ), std::end( order_ ), better );
+
+            auto const middle{ std::next( std::begin( order_ ), static_cast< std::ptrdiff_t >( sorted_ ) ) };
+            std::nth_element( std::begin( order_ ), std::prev( middle ), std::end( order_ ), better );
+            std::sort( std::begin( order_ ), middle, better );
+        }
+    }
+
+    inline std::size_t size  () const noexcept { return std::size( order_ ); }
+    inline std::size_t sorted() const noexcept { return sorted_;             }
+
+    // Index of the individual with the given rank, 0 being the best. Rank must
+    // be smaller than sorted().
+    inline std::size_t operator[]( std::size_t const rank ) const noexcept
+    {
+        assert( rank < sorted_ );
+        return order_[ rank ];
+    }
+
+    // Indices of the sorted() best individuals, best first.
+    inline Span< std::size_t const > order() const noexcept { return { order_.data(), sorted_ }; }
+
+    inline std::size_t best () const noexcept { assert( size() > 0 ); return order_[ 0 ]; }
+    inline std::size_t worst() const noexcept { assert( size() > 0 ); return worst_;      }
+
+    inline double bestFitness () const noexcept { return fitness_[ best () ]; }
+    inline double worstFitness() const noexcept { return fitness_[ worst() ]; }
+
+    inline double fitnessSum() const noexcept { return cumulative_.empty() ? 0 : cumulative_.back(); }
+
+    // Fitness of individual index when ranking was updated.
+    inline double fitness( std::size_t const index ) const noexcept { return fitness_[ index ]; }
+
+    // Fitness of every individual, by index.
+    inline Span< double const > fitnesses() const noexcept { return { fitness_.data(), std::size( fitness_ ) }; }
+
+    // Sums of fitness of individuals 0 ... i, for every index i.
+    inline Span< double const > cumulativeFitness() const noexcept { return { cumulative_.data(), std::size( cumulative_ ) }; }
+
+private:
+    std::vector< double >      fitness_;
+    std::vector< double >      cumulative_;
+    std::vector< std::size_t > order_;
+    std::size_t                sorted_{ 0 };
+    std::size_t                worst_ { 0 };
+};
+
+}
+
+#endif // ECFCPP_RANKING_HPP
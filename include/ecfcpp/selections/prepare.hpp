@@ -0,0 +1,79 @@
+#ifndef ECFCPP_SELECTIONS_PREPARE_HPP
+#define ECFCPP_SELECTIONS_PREPARE_HPP
+
+#include <ecfcpp/ranking.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace ecfcpp::selection
+{
+
+// Selections which need all individuals ranked, not just the best ones,
+// declare static constexpr bool needsRanking{ true }.
+template< typename Selection, typename = void >
+struct NeedsRanking : std::false_type {};
+
+template< typename Selection >
+struct NeedsRanking< Selection, std::void_t< decltype( Selection::needsRanking ) > > :
+    std::bool_constant< Selection::needsRanking >
+{};
+
+template< typename Selection >
+constexpr inline bool needsRanking{ NeedsRanking< Selection >::value };
+
+template< typename Selection, typename Population, typename = void >
+struct HasPrepare : std::false_type {};
+
+template< typename Selection, typename Population >
+struct HasPrepare
+<
+    Selection,
+    Population,
+    std::void_t
+    <
+        decltype( std::declval< Selection const & >().prepare( std::declval< Population const & >(), std::declval< Ranking const & >() ) )
+    >
+> : std::true_type {};
+
+template< typename Selection, typename Population, typename = void >
+struct HasSelect : std::false_type {};
+
+template< typename Selection, typename Population >
+struct HasSelect
+<
+    Selection,
+    Population,
+    std::void_t
+    <
+        decltype( std::declval< Selection const & >().select( std::declval< Population const & >(), std::size_t{}, std::declval< std::size_t * >() ) )
+    >
+> : std::true_type {};
+
+// Selections which pick count individuals of population at once, writing their
+// indices to out[ 0 ] ... out[ count - 1 ], are called as
+// selection.select( population, count, out ).
+template< typename Selection, typename Population >
+constexpr inline bool hasSelect{ HasSelect< std::remove_cv_t< std::remove_reference_t< Selection > >, Population >::value };
+
+// Selection to use for one generation of population, ranked by ranking.
+// Selections called as selection.prepare( population, ranking ) do their work
+// common to all picks there and return a sampler, called as sampler( population )
+// until population or ranking change. Other selections are used as they are.
+template< typename Selection, typename Population >
+decltype( auto ) prepare( Selection const & selection, Population const & population, Ranking const & ranking )
+{
+    if constexpr ( HasPrepare< Selection, Population >::value )
+    {
+        return selection.prepare( population, ranking );
+    }
+    else
+    {
+        return ( selection );
+    }
+}
+
+}
+
+#endif // ECFCPP_SELECTIONS_PREPARE_HPP
@@ -0,0 +1,100 @@
+#ifndef ECFCPP_SELECTIONS_RANK_HPP
+#define ECFCPP_SELECTIONS_RANK_HPP
+
+#include <ecfcpp/ranking.hpp>
+#include <ecfcpp/utils/random.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+
+namespace ecfcpp::selection
+{
+
+// Linear ranking selection. Probability of picking an individual falls
+// linearly with its rank, so that the best one is expected to be picked
+// pressure times per population size picks and the worst one 2 - pressure
+// times. Pressure is in [1, 2]; 1 picks uniformly.
+class Rank
+{
+public:
+    static constexpr bool needsRanking{ true };
+
+    // Picks individuals of a ranked population in constant time.
+    class Sampler
+    {
+    public:
+        constexpr Sampler( Ranking const & ranking, double const pressure ) noexcept :
+            ranking_ { &ranking },
+            pressure_{ pressure }
+        {}
+
+        template< typename Population >
+        decltype( auto ) operator()( Population const & population ) const
+        {
+            std::size_t index;
+            select( population, 1, &index );
+            return population[ index ];
+        }
+
+        // Smaller of two uniform ranks has linearly falling probabilities; it
+        // is mixed with a uniform rank to get the desired pressure.
+        template< typename Population >
+        void select( Population const & population, std::size_t const count, std::size_t * const out ) const
+        {
+            assert( ranking_->sorted() == std::size( population ) );
+
+            auto const size{ std::size( population ) };
+            for ( std::size_t j{ 0 }; j < count; ++j )
+            {
+                auto rank{ random::uniform( 0UL, size ) };
+                if ( random::uniform< double >() < pressure_ - 1 )
+                {
+                    rank = std::min( rank, random::uniform( 0UL, size ) );
+                }
+                out[ j ] = ( *ranking_ )[ rank ];
+            }
+        }
+
+    private:
+        Ranking const * ranking_;
+        double          pressure_;
+    };
+
+    constexpr Rank( double const pressure = 2 ) noexcept : pressure_{ pressure }
+    {
+        assert( pressure_ >= 1 && pressure_ <= 2 );
+    }
+
+    template< typename Population >
+    Sampler prepare( Population const &, Ranking const & ranking ) const noexcept
+    {
+        return { ranking, pressure_ };
+    }
+
+    // Ranks population on every call. Engines prepare the selection once per
+    // generation instead.
+    template< typename Population >
+    decltype( auto ) operator()( Population const & population ) const
+    {
+        Ranking ranking;
+        ranking.update( population );
+        return prepare( population, ranking )( population );
+    }
+
+    template< typename Population >
+    void select( Population const & population, std::size_t const count, std::size_t * const out ) const
+    {
+        Ranking ranking;
+        ranking.update( population );
+        prepare( population, ranking ).select( population, count, out );
+    }
+
+private:
+    double pressure_;
+};
+
+}
+
+#endif // ECFCPP_SELECTIONS_RANK_HPP
@@ -1,56 +1,204 @@
 #ifndef ECFCPP_SELECTIONS_ROULETTE_WHEEL_HPP
 #define ECFCPP_SELECTIONS_ROULETTE_WHEEL_HPP
 
+#include <ecfcpp/ranking.hpp>
 #include <ecfcpp/types.hpp>
 #include <ecfcpp/utils/random.hpp>
 
-#include <cmath>
+#include <algorithm>
+#include <cstddef>
 #include <iterator>
-#include <numeric>
+#include <limits>
+#include <utility>
+#include <vector>
 
 namespace ecfcpp::selection
 {
 
+// Fitness proportional selection. With useFitness, weight of an individual is
+// its fitness, shifted up by the worst one when some fitness is negative.
+// Otherwise its weight is the amount by which its penalty is lower than the
+// worst penalty in the population. When all weights are zero every individual
+// is equally likely.
 class RouletteWheel
 {
 public:
-    constexpr RouletteWheel() noexcept = default;
+    // Picks individuals in constant time from Vose's alias table of the
+    // weights, built once. Storage of the table is handed over to the next
+    // sampler built on the same thread, so that engines preparing one every
+    // generation do not allocate.
+    class Sampler
+    {
+    public:
+        Sampler( std::vector< double > const & weights ) : tables_{ std::move( spare() ) }
+        {
+            auto const size{ std::size( weights ) };
 
-    constexpr RouletteWheel( bool const useFitness ) noexcept : useFitness_{ useFitness } {}
+            auto & probability{ tables_.probability };
+            auto & alias      { tables_.alias       };
+            probability.resize( size );
+            alias      .resize( size );
 
-    template< typename T >
-    constexpr T const & operator()( Population< T > const & population ) const noexcept
-    {
-        auto const fitnessSum
-        {
-            std::accumulate
-            (
-                std::begin( population ),
-                std::end  ( population ),
-                static_cast< typename T::decimal_t >( 0 ),
-                [ this ]( auto const & current, auto const & individual )
+            double sum{ 0 };
+            for ( auto const weight : weights )
+            {
+                sum += weight;
+            }
+
+            // Work lists, kept per thread.
+            static thread_local std::vector< std::size_t > small, large;
+            small.clear();
+            large.clear();
+            small.reserve( size );
+            large.reserve( size );
+
+            for ( std::size_t i{ 0 }; i < size; ++i )
+            {
+                probability[ i ] = sum > 0 ? weights[ i ] * size / sum : 1;
+                ( probability[ i ] < 1 ? small : large ).push_back( i );
+            }
+
+            while ( !small.empty() && !large.empty() )
+            {
+                auto const less{ small.back() };
+                auto const more{ large.back() };
+                small.pop_back();
+
+                alias[ less ] = more;
+                probability[ more ] -= 1 - probability[ less ];
+
+                if ( probability[ more ] < 1 )
                 {
-                    return current + std::abs( useFitness_ ? individual.fitness : individual.penalty );
+                    large.pop_back();
+                    small.push_back( more );
                 }
-            )
+            }
+
+            // Leftovers are due to rounding, their probability is one.
+            for ( auto const i : small ) { probability[ i ] = 1; }
+            for ( auto const i : large ) { probability[ i ] = 1; }
+        }
+
+        Sampler( Sampler const & ) = default;
+        Sampler( Sampler && ) noexcept = default;
+
+        Sampler & operator=( Sampler const & ) = default;
+        Sampler & operator=( Sampler && ) noexcept = default;
+
+        ~Sampler()
+        {
+            auto & tables{ spare() };
+            if ( tables.probability.capacity() < tables_.probability.capacity() )
+            {
+                tables = std::move( tables_ );
+            }
+        }
+
+        template< typename Population >
+        decltype( auto ) operator()( Population const & population ) const noexcept
+        {
+            std::size_t index;
+            select( population, 1, &index );
+            return population[ index ];
+        }
+
+        template< typename Population >
+        void select( Population const &, std::size_t const count, std::size_t * const out ) const noexcept
+        {
+            for ( std::size_t j{ 0 }; j < count; ++j )
+            {
+                auto const column{ random::uniform( 0UL, std::size( tables_.probability ) ) };
+                out[ j ] = random::uniform< double >() < tables_.probability[ column ] ? column : tables_.alias[ column ];
+            }
+        }
+
+    private:
+        struct Tables
+        {
+            std::vector< double >      probability;
+            std::vector< std::size_t > alias;
         };
 
-        auto const randomValue{ random::uniform< typename T::decimal_t >() }; 
-        typename T::decimal_t cumulativeFitness{ 0 };
+        // Storage left by the last sampler destroyed on this thread.
+        static Tables & spare() noexcept
+        {
+            static thread_local Tables tables;
+            return tables;
+        }
+
+        Tables tables_;
+    };
+
+    constexpr RouletteWheel() noexcept = default;
+
+    constexpr RouletteWheel( bool const useFitness ) noexcept : useFitness_{ useFitness } {}
+
+    template< typename Population >
+    Sampler prepare( Population const & population, Ranking const & ) const
+    {
+        return { weights( population ) };
+    }
+
+    template< typename Population >
+    void select( Population const & population, std::size_t const count, std::size_t * const out ) const
+    {
+        Sampler{ weights( population ) }.select( population, count, out );
+    }
+
+    // Scans the whole population on every call. Engines prepare the selection
+    // once per generation instead.
+    template< typename Population >
+    decltype( auto ) operator()( Population const & population ) const
+    {
+        auto const & individualWeights{ weights( population ) };
+
+        double sum{ 0 };
+        for ( auto const weight : individualWeights )
+        {
+            sum += weight;
+        }
+
+        auto const randomValue{ random::uniform< double >() * sum };
+        double cumulativeWeight{ 0 };
 
-        for ( auto const & individual : population )
+        for ( std::size_t i{ 0 }; i < std::size( population ); ++i )
         {
-            cumulativeFitness += std::abs( useFitness_ ? individual.fitness : individual.penalty );
-            if ( randomValue < cumulativeFitness / fitnessSum )
+            cumulativeWeight += individualWeights[ i ];
+            if ( randomValue < cumulativeWeight )
             {
-                return individual;
+                return population[ i ];
             }
         }
 
-        return population.back();
+        return population[ sum > 0 ? std::size( population ) - 1 : random::uniform( 0UL, std::size( population ) ) ];
     }
 
 private:
+    // Storage is kept per thread and reused by the next call on the same
+    // thread.
+    template< typename Population >
+    std::vector< double > const & weights( Population const & population ) const
+    {
+        static thread_local std::vector< double > result;
+        result.resize( std::size( population ) );
+
+        double lowest { std::numeric_limits< double >::max()    };
+        double highest{ std::numeric_limits< double >::lowest() };
+        for ( std::size_t i{ 0 }; i < std::size( population ); ++i )
+        {
+            result[ i ] = useFitness_ ? population[ i ].fitness : population[ i ].penalty;
+            lowest      = std::min( lowest,  result[ i ] );
+            highest     = std::max( highest, result[ i ] );
+        }
+
+        for ( auto & weight : result )
+        {
+            weight = useFitness_ ? weight - std::min( lowest, 0.0 ) : highest - weight;
+        }
+
+        return result;
+    }
+
     bool useFitness_{ true };
 };
 
@@ -1,2 +1,4 @@
+#include "prepare.hpp"
+#include "rank.hpp"
 #include "roulette_wheel.hpp"
 #include "tournament.hpp"
\ No newline at end of file
@@ -1,12 +1,15 @@
 #ifndef ECFCPP_SELECTIONS_TOURNAMENT_HPP
 #define ECFCPP_SELECTIONS_TOURNAMENT_HPP
 
+#include <ecfcpp/ranking.hpp>
+#include <ecfcpp/span.hpp>
 #include <ecfcpp/types.hpp>
 #include <ecfcpp/utils/random.hpp>
 
 #include <cassert>
-#include <cstdint>
+#include <cstddef>
 #include <iterator>
+#include <vector>
 
 namespace ecfcpp::selection
 {
@@ -14,31 +17,107 @@ namespace ecfcpp::selection
 class Tournament
 {
 public:
+    // Runs tournaments on fitness as recorded by a ranking, which is stored
+    // contiguously.
+    class Sampler
+    {
+    public:
+        constexpr Sampler( Span< double const > const fitness, std::size_t const size ) noexcept :
+            fitness_{ fitness },
+            size_   { size    }
+        {}
+
+        template< typename Population >
+        decltype( auto ) operator()( Population const & population ) const noexcept
+        {
+            assert( std::size( population ) == std::size( fitness_ ) );
+
+            auto const N{ std::size( population ) };
+
+            auto best{ random::uniform( 0UL, N ) };
+
+            for ( std::size_t i{ 1 }; i < size_; ++i )
+            {
+                auto const picked{ random::uniform( 0UL, N ) };
+                if ( fitness_[ picked ] > fitness_[ best ] )
+                {
+                    best = picked;
+                }
+            }
+
+            return population[ best ];
+        }
+
+        // Runs count tournaments. All candidates are drawn first, so that the
+        // comparisons run over a flat array.
+        template< typename Population >
+        void select( Population const & population, std::size_t const count, std::size_t * const out ) const
+        {
+            assert( std::size( population ) == std::size( fitness_ ) );
+
+            // Kept per thread so that repeated calls do not allocate.
+            static thread_local std::vector< std::size_t > candidates;
+            candidates.resize( count * size_ );
+
+            random::fillIndices( { candidates.data(), std::size( candidates ) }, 0, std::size( population ) );
+
+            for ( std::size_t j{ 0 }; j < count; ++j )
+            {
+                auto const * const round{ candidates.data() + j * size_ };
+
+                auto best{ round[ 0 ] };
+                for ( std::size_t i{ 1 }; i < size_; ++i )
+                {
+                    best = fitness_[ round[ i ] ] > fitness_[ best ] ? round[ i ] : best;
+                }
+                out[ j ] = best;
+            }
+        }
+
+    private:
+        Span< double const > fitness_;
+        std::size_t          size_;
+    };
+
     constexpr Tournament( std::size_t const size ) noexcept : size_{ size }
     {
         assert( size_ > 0 );
     }
 
-    template< typename T >
-    constexpr T const & operator()( Population< T > const & population ) const noexcept
+    template< typename Population >
+    constexpr decltype( auto ) operator()( Population const & population ) const noexcept
     {
         assert( std::size( population ) >= size_ );
 
         auto const N{ std::size( population ) };
 
-        T const * best{ nullptr };
+        auto best{ random::uniform( 0UL, N ) };
 
-        std::size_t tournaments{ size_ - 1 };
-        while ( tournaments-- > 0 )
+        for ( std::size_t i{ 1 }; i < size_; ++i )
         {
-            auto const * picked{ &population[ random::uniform( 0UL, N ) ] };
-            if ( best == nullptr || *picked > *best )
+            auto const picked{ random::uniform( 0UL, N ) };
+            if ( population[ picked ] > population[ best ] )
             {
                 best = picked;
             }
         }
 
-        return *best;
+        return population[ best ];
+    }
+
+    template< typename Population >
+    Sampler prepare( Population const &, Ranking const & ranking ) const noexcept
+    {
+        return { ranking.fitnesses(), size_ };
+    }
+
+    // Runs count tournaments, writing indices of their winners to out.
+    template< typename Population >
+    void select( Population const & population, std::size_t const count, std::size_t * const out ) const
+    {
+        Ranking ranking;
+        ranking.update( population, 1 );
+        prepare( population, ranking ).select( population, count, out );
     }
 
 private:
@@ -0,0 +1,52 @@
+#ifndef ECFCPP_SPAN_HPP
+#define ECFCPP_SPAN_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+namespace ecfcpp
+{
+
+// Contiguous sequence of elements owned by someone else, in the manner of
+// std::span. Iterators are plain pointers.
+template< typename T >
+class Span
+{
+public:
+    using element_type    = T;
+    using value_type      = std::remove_cv_t< T >;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer         = T *;
+    using reference       = T &;
+    using iterator        = T *;
+
+    constexpr Span() noexcept = default;
+
+    constexpr Span( pointer const data, std::size_t const size ) noexcept : data_{ data }, size_{ size } {}
+
+    template< typename U, typename = std::enable_if_t< std::is_convertible_v< U( * )[], T( * )[] > > >
+    constexpr Span( Span< U > const & other ) noexcept : data_{ other.data() }, size_{ other.size() } {}
+
+    constexpr inline reference operator[]( std::size_t const index ) const noexcept
+    {
+        assert( index < size_ );
+        return data_[ index ];
+    }
+
+    constexpr inline pointer     data () const noexcept { return data_;      }
+    constexpr inline std::size_t size () const noexcept { return size_;      }
+    constexpr inline bool        empty() const noexcept { return size_ == 0; }
+
+    constexpr inline iterator begin() const noexcept { return data_;         }
+    constexpr inline iterator end  () const noexcept { return data_ + size_; }
+
+private:
+    pointer     data_{ nullptr };
+    std::size_t size_{ 0       };
+};
+
+}
+
+#endif // ECFCPP_SPAN_HPP
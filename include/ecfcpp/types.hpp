@@ -2,7 +2,10 @@
 #define ECFCPP_TYPES_HPP
 
 #include <vector>
+#include <cstddef>
 #include <ostream>
+#include <type_traits>
+#include <utility>
 
 namespace ecfcpp
 {
@@ -15,6 +18,51 @@ using Container = std::vector< T >;
 
 using decimal_t = float;
 
+// Standalone copy of an individual. Populations which hand out views of their
+// individuals declare the type of such a copy as individual_type of the view.
+template< typename T, typename = void >
+struct IndividualType
+{
+    using type = T;
+};
+
+template< typename T >
+struct IndividualType< T, std::void_t< typename T::individual_type > >
+{
+    using type = typename T::individual_type;
+};
+
+template< typename T >
+using individual_t = typename IndividualType< std::remove_cv_t< std::remove_reference_t< T > > >::type;
+
+// Functions which score individuals [begin, end) of a population at once are
+// called as function( population, begin, end, out ), with out indexed by individual.
+template< typename Function, typename Population, typename = void >
+struct IsBatchFunction : std::false_type {};
+
+template< typename Function, typename Population >
+struct IsBatchFunction
+<
+    Function,
+    Population,
+    std::void_t
+    <
+        decltype
+        (
+            std::declval< Function const & >()
+            (
+                std::declval< Population const & >(),
+                std::size_t{},
+                std::size_t{},
+                std::declval< typename Population::decimal_t * >()
+            )
+        )
+    >
+> : std::true_type {};
+
+template< typename Function, typename Population >
+constexpr inline bool isBatchFunction{ IsBatchFunction< Function, Population >::value };
+
 }
 
 template< typename T >
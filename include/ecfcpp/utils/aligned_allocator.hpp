@@ -0,0 +1,49 @@
+#ifndef ECFCPP_UTILS_ALIGNED_ALLOCATOR_HPP
+#define ECFCPP_UTILS_ALIGNED_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+
+namespace ecfcpp
+{
+
+// Allocator which aligns storage to Alignment bytes, e.g. to a cache line.
+template< typename T, std::size_t Alignment = 64 >
+class AlignedAllocator
+{
+public:
+    static_assert( Alignment >= alignof( T ) && ( Alignment & ( Alignment - 1 ) ) == 0 );
+
+    using value_type = T;
+
+    template< typename U >
+    struct rebind
+    {
+        using other = AlignedAllocator< U, Alignment >;
+    };
+
+    constexpr AlignedAllocator() noexcept = default;
+
+    template< typename U >
+    constexpr AlignedAllocator( AlignedAllocator< U, Alignment > const & ) noexcept {}
+
+    [[ nodiscard ]] T * allocate( std::size_t const count )
+    {
+        return static_cast< T * >( ::operator new( count * sizeof( T ), std::align_val_t{ Alignment } ) );
+    }
+
+    void deallocate( T * const pointer, std::size_t const ) noexcept
+    {
+        ::operator delete( pointer, std::align_val_t{ Alignment } );
+    }
+
+    template< typename U >
+    constexpr inline bool operator==( AlignedAllocator< U, Alignment > const & ) const noexcept { return true; }
+
+    template< typename U >
+    constexpr inline bool operator!=( AlignedAllocator< U, Alignment > const & ) const noexcept { return false; }
+};
+
+}
+
+#endif // ECFCPP_UTILS_ALIGNED_ALLOCATOR_HPP
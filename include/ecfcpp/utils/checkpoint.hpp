@@ -0,0 +1,488 @@
+#ifndef ECFCPP_UTILS_CHECKPOINT_HPP
+#define ECFCPP_UTILS_CHECKPOINT_HPP
+
+#include <ecfcpp/utils/random.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ecfcpp::checkpoint
+{
+
+// Checkpoint files start with this header, on a page of its own, followed by
+// two slots. Checkpoints are written to the slot which does not hold the
+// latest one, which is replaced only after the new one is on disk, so a crash
+// while writing leaves the previous checkpoint intact. Every slot holds the
+// random stream of the engine thread, fitness and penalty of every individual
+// as doubles and then genes of every individual in turn, all in the byte order
+// of the machine which wrote them.
+struct Header
+{
+    static constexpr std::uint32_t none{ 2 };
+
+    char          magic[ 8 ]      { 'E', 'C', 'F', 'C', 'K', 'P', 'T', '\0' };
+    std::uint32_t version         { 1                                       };
+    std::uint32_t geneSize        { 0                                       };
+    std::uint64_t streamSize      { sizeof( random::Stream )                };
+    std::uint64_t count           { 0                                       };
+    std::uint64_t dimension       { 0                                       };
+    std::uint64_t slotSize        { 0                                       };
+    std::uint64_t generations[ 2 ]{ 0, 0                                    };
+    std::uint32_t latest          { none                                    };
+    std::uint32_t reserved        { 0                                       };
+};
+
+static_assert( std::is_trivially_copyable_v< random::Stream >, "Streams are saved as they are laid out in memory." );
+
+namespace detail
+{
+
+template< typename Population >
+using gene_t = std::decay_t< decltype( std::declval< Population const & >()[ 0 ].data()[ 0 ] ) >;
+
+inline std::size_t pageSize() noexcept
+{
+    return static_cast< std::size_t >( ::sysconf( _SC_PAGESIZE ) );
+}
+
+constexpr std::size_t roundUp( std::size_t const size, std::size_t const multiple ) noexcept
+{
+    return ( size + multiple - 1 ) / multiple * multiple;
+}
+
+// Offsets of the parts of a slot.
+struct Layout
+{
+    constexpr Layout( std::size_t const count, std::size_t const dimension, std::size_t const geneSize ) noexcept :
+        fitness{ roundUp( sizeof( random::Stream ), sizeof( double ) ) },
+        penalty{ fitness + count * sizeof( double )                   },
+        genes  { penalty + count * sizeof( double )                   },
+        size   { genes   + count * dimension * geneSize               }
+    {}
+
+    std::size_t fitness;
+    std::size_t penalty;
+    std::size_t genes;
+    std::size_t size;
+};
+
+// Header of a file which fits population, unless it is empty.
+template< typename Population >
+Header headerOf( Population const & population )
+{
+    Header header;
+    header.geneSize  = sizeof( gene_t< Population > );
+    header.count     = std::size( population );
+    header.dimension = std::empty( population ) ? 0 : std::size( population[ 0 ].data() );
+    header.slotSize  = roundUp( Layout{ header.count, header.dimension, header.geneSize }.size, pageSize() );
+    return header;
+}
+
+inline bool sameLayout( Header const & lhs, Header const & rhs ) noexcept
+{
+    Header const expected;
+    return std::memcmp( lhs.magic, expected.magic, sizeof( lhs.magic ) ) == 0 &&
+           lhs.version    == expected.version                              &&
+           lhs.geneSize   == rhs.geneSize                                  &&
+           lhs.streamSize == rhs.streamSize                                &&
+           lhs.count      == rhs.count                                     &&
+           lhs.dimension  == rhs.dimension                                 &&
+           lhs.slotSize   == rhs.slotSize;
+}
+
+// Memory mapping of a whole file, unmapped and closed on destruction.
+class Mapping
+{
+public:
+    Mapping() = default;
+
+    Mapping( int const file, std::size_t const size, bool const writable ) : file_{ file }
+    {
+        if ( file_ < 0 )
+        {
+            return;
+        }
+
+        auto * const address
+        {
+            ::mmap( nullptr, size, writable ? PROT_READ | PROT_WRITE : PROT_READ, writable ? MAP_SHARED : MAP_PRIVATE, file_, 0 )
+        };
+
+        if ( address != MAP_FAILED )
+        {
+            data_ = static_cast< unsigned char * >( address );
+            size_ = size;
+        }
+    }
+
+    Mapping( Mapping const & ) = delete;
+    Mapping & operator=( Mapping const & ) = delete;
+
+    Mapping( Mapping && other ) noexcept :
+        file_{ std::exchange( other.file_, -1      ) },
+        data_{ std::exchange( other.data_, nullptr ) },
+        size_{ std::exchange( other.size_, 0       ) }
+    {}
+
+    Mapping & operator=( Mapping && other ) noexcept
+    {
+        std::swap( file_, other.file_ );
+        std::swap( data_, other.data_ );
+        std::swap( size_, other.size_ );
+        return *this;
+    }
+
+    ~Mapping()
+    {
+        if ( data_ != nullptr )
+        {
+            ::munmap( data_, size_ );
+        }
+        if ( file_ >= 0 )
+        {
+            ::close( file_ );
+        }
+    }
+
+    inline unsigned char * data() const noexcept { return data_;            }
+    inline std::size_t     size() const noexcept { return size_;            }
+    inline bool            good() const noexcept { return data_ != nullptr; }
+
+    // Takes the file descriptor back, leaving the mapping in place.
+    inline int release() noexcept { return std::exchange( file_, -1 ); }
+
+private:
+    int             file_{ -1      };
+    unsigned char * data_{ nullptr };
+    std::size_t     size_{ 0       };
+};
+
+inline std::size_t fileSize( int const file ) noexcept
+{
+    struct stat status;
+    return file >= 0 && ::fstat( file, &status ) == 0 ? static_cast< std::size_t >( status.st_size ) : 0;
+}
+
+inline Header readHeader( unsigned char const * const data ) noexcept
+{
+    Header header;
+    std::memcpy( &header, data, sizeof( header ) );
+    return header;
+}
+
+}
+
+// Saves checkpoints of a population to a memory-mapped file on a background
+// thread. The engine thread only copies the population and its random stream
+// into a staging buffer. The writer then copies to the file only pages which
+// differ from the checkpoint already in the slot, so unchanged parts of the
+// population are not written again, and syncs them to disk. A checkpoint
+// requested while the previous one is still being written is skipped, so the
+// engine never waits for the disk.
+class Writer
+{
+public:
+    explicit Writer( std::string const & path ) : file_{ ::open( path.c_str(), O_RDWR | O_CREAT, 0644 ) }
+    {
+        if ( file_ >= 0 )
+        {
+            thread_ = std::thread{ [ this ](){ work(); } };
+        }
+    }
+
+    Writer( Writer const & ) = delete;
+    Writer( Writer &&      ) = delete;
+
+    Writer & operator=( Writer const & ) = delete;
+    Writer & operator=( Writer &&      ) = delete;
+
+    // Finishes the checkpoint being written.
+    ~Writer()
+    {
+        if ( thread_.joinable() )
+        {
+            {
+                std::lock_guard< std::mutex > const lock{ mutex_ };
+                stop_ = true;
+            }
+            wake_.notify_all();
+            thread_.join();
+        }
+
+        mapping_ = {};
+        if ( file_ >= 0 )
+        {
+            ::close( file_ );
+        }
+    }
+
+    // Starts checkpointing population and the random stream of the calling
+    // thread as of generation. Returns false if the checkpoint is skipped,
+    // because the previous one is still being written, the population no
+    // longer fits the file or writing failed.
+    template< typename Population >
+    bool save( Population const & population, std::uint64_t const generation )
+    {
+        using Gene = detail::gene_t< Population >;
+        static_assert( std::is_trivially_copyable_v< Gene >, "Genes are saved as they are laid out in memory." );
+
+        {
+            std::lock_guard< std::mutex > const lock{ mutex_ };
+            if ( file_ < 0 || pending_ || failed_ )
+            {
+                return false;
+            }
+        }
+
+        auto const header{ detail::headerOf( population ) };
+        if ( header_.slotSize != 0 && !detail::sameLayout( header_, header ) )
+        {
+            return false;
+        }
+        header_ = header;
+
+        detail::Layout const layout{ header.count, header.dimension, header.geneSize };
+        staging_.resize( layout.size );
+
+        auto * const staging{ staging_.data() };
+        std::memcpy( staging, &random::stream(), sizeof( random::Stream ) );
+
+        for ( std::size_t i{ 0 }; i < header.count; ++i )
+        {
+            auto const & individual{ population[ i ] };
+
+            double const fitness{ individual.fitness };
+            double const penalty{ individual.penalty };
+            std::memcpy( staging + layout.fitness + i * sizeof( double ), &fitness, sizeof( double ) );
+            std::memcpy( staging + layout.penalty + i * sizeof( double ), &penalty, sizeof( double ) );
+
+            auto const & genes{ individual.data() };
+            auto * const row{ staging + layout.genes + i * header.dimension * sizeof( Gene ) };
+            for ( std::size_t j{ 0 }; j < header.dimension; ++j )
+            {
+                Gene const gene{ genes[ j ] };
+                std::memcpy( row + j * sizeof( Gene ), &gene, sizeof( Gene ) );
+            }
+        }
+
+        {
+            std::lock_guard< std::mutex > const lock{ mutex_ };
+            pending_    = true;
+            generation_ = generation;
+        }
+        wake_.notify_all();
+        return true;
+    }
+
+    // Waits until the checkpoint being written, if any, is on disk.
+    void wait()
+    {
+        std::unique_lock< std::mutex > lock{ mutex_ };
+        done_.wait( lock, [ this ](){ return !pending_; } );
+    }
+
+    // Whether every checkpoint so far was written.
+    bool good() const
+    {
+        std::lock_guard< std::mutex > const lock{ mutex_ };
+        return file_ >= 0 && !failed_;
+    }
+
+    // Generation of the latest checkpoint on disk, if any.
+    std::optional< std::uint64_t > latest() const
+    {
+        std::lock_guard< std::mutex > const lock{ mutex_ };
+        return latest_;
+    }
+
+private:
+    void work()
+    {
+        std::unique_lock< std::mutex > lock{ mutex_ };
+
+        for ( ;; )
+        {
+            wake_.wait( lock, [ this ](){ return stop_ || pending_; } );
+
+            if ( pending_ )
+            {
+                auto const generation{ generation_ };
+
+                // Staging buffer and header are left alone while pending.
+                lock.unlock();
+                auto const written{ write( generation ) };
+                lock.lock();
+
+                failed_  = !written;
+                latest_  = written ? std::optional< std::uint64_t >{ generation } : latest_;
+                pending_ = false;
+                done_.notify_all();
+            }
+            else if ( stop_ )
+            {
+                return;
+            }
+        }
+    }
+
+    bool write( std::uint64_t const generation )
+    {
+        auto const page{ detail::pageSize() };
+        auto const size{ page + 2 * header_.slotSize };
+
+        if ( !mapping_.good() )
+        {
+            // A file left by an earlier run with the same layout keeps its
+            // latest checkpoint until a new one is complete.
+            auto const reuse{ detail::fileSize( file_ ) == size };
+            if ( !reuse && ::ftruncate( file_, static_cast< off_t >( size ) ) != 0 )
+            {
+                return false;
+            }
+
+            mapping_ = detail::Mapping{ ::dup( file_ ), size, true };
+            if ( !mapping_.good() )
+            {
+                return false;
+            }
+
+            if ( !reuse || !detail::sameLayout( detail::readHeader( mapping_.data() ), header_ ) )
+            {
+                std::memcpy( mapping_.data(), &header_, sizeof( header_ ) );
+            }
+        }
+
+        auto header{ detail::readHeader( mapping_.data() ) };
+        auto const slot{ header.latest == 0 ? 1U : 0U };
+
+        auto * const target{ mapping_.data() + page + slot * header_.slotSize };
+        auto const * const source{ staging_.data() };
+
+        for ( std::size_t offset{ 0 }; offset < std::size( staging_ ); offset += page )
+        {
+            auto const length{ std::min( page, std::size( staging_ ) - offset ) };
+            if ( std::memcmp( target + offset, source + offset, length ) != 0 )
+            {
+                std::memcpy( target + offset, source + offset, length );
+            }
+        }
+
+        if ( ::msync( target, header_.slotSize, MS_SYNC ) != 0 )
+        {
+            return false;
+        }
+
+        header.generations[ slot ] = generation;
+        header.latest              = slot;
+        std::memcpy( mapping_.data(), &header, sizeof( header ) );
+
+        return ::msync( mapping_.data(), page, MS_SYNC ) == 0;
+    }
+
+    int                            file_;
+    detail::Mapping                mapping_;
+    Header                         header_;
+    std::vector< unsigned char >   staging_;
+    std::optional< std::uint64_t > latest_;
+    std::uint64_t                  generation_{ 0     };
+    bool                           pending_   { false };
+    bool                           failed_    { false };
+    bool                           stop_      { false };
+    mutable std::mutex             mutex_;
+    std::condition_variable        wake_;
+    std::condition_variable        done_;
+    std::thread                    thread_;
+};
+
+// Restores population and the random stream of the calling thread from the
+// latest checkpoint in the file at path. Population must have as many
+// individuals, of the same dimension and gene type, as the saved one. Returns
+// the generation of the checkpoint, or nothing, leaving population as it was,
+// if there is no checkpoint which fits it.
+template< typename Population >
+std::optional< std::uint64_t > restore( std::string const & path, Population & population )
+{
+    using Gene = detail::gene_t< Population >;
+
+    auto const file{ ::open( path.c_str(), O_RDONLY ) };
+    auto const size{ detail::fileSize( file ) };
+    auto const page{ detail::pageSize() };
+
+    if ( size < page )
+    {
+        if ( file >= 0 )
+        {
+            ::close( file );
+        }
+        return std::nullopt;
+    }
+
+    detail::Mapping const mapping{ file, size, false };
+    if ( !mapping.good() )
+    {
+        return std::nullopt;
+    }
+
+    auto const header{ detail::readHeader( mapping.data() ) };
+    if
+    (
+        !detail::sameLayout( header, detail::headerOf( population ) ) ||
+        header.latest >= 2                                            ||
+        size < page + 2 * header.slotSize
+    )
+    {
+        return std::nullopt;
+    }
+
+    ::madvise( mapping.data(), size, MADV_SEQUENTIAL );
+
+    detail::Layout const layout{ header.count, header.dimension, header.geneSize };
+    auto const * const slot{ mapping.data() + page + header.latest * header.slotSize };
+
+    random::Stream stream{ 0 };
+    std::memcpy( &stream, slot, sizeof( random::Stream ) );
+    random::stream() = stream;
+
+    for ( std::size_t i{ 0 }; i < header.count; ++i )
+    {
+        auto && individual{ population[ i ] };
+
+        double fitness;
+        double penalty;
+        std::memcpy( &fitness, slot + layout.fitness + i * sizeof( double ), sizeof( double ) );
+        std::memcpy( &penalty, slot + layout.penalty + i * sizeof( double ), sizeof( double ) );
+        individual.fitness = fitness;
+        individual.penalty = penalty;
+
+        auto && genes{ individual.data() };
+        auto const * const row{ slot + layout.genes + i * header.dimension * sizeof( Gene ) };
+        for ( std::size_t j{ 0 }; j < header.dimension; ++j )
+        {
+            Gene gene;
+            std::memcpy( &gene, row + j * sizeof( Gene ), sizeof( Gene ) );
+            genes[ j ] = gene;
+        }
+    }
+
+    return header.generations[ header.latest ];
+}
+
+}
+
+#endif // ECFCPP_UTILS_CHECKPOINT_HPP
@@ -5,9 +5,22 @@
 #include <pcg_random.hpp>
 #endif
 
+#include <ecfcpp/span.hpp>
+#include <ecfcpp/types.hpp>
+#include <ecfcpp/utils/xoshiro.hpp>
+#include <ecfcpp/utils/ziggurat.hpp>
+
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <random>
+#include <tuple>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace ecfcpp
 {
@@ -15,46 +28,231 @@ namespace ecfcpp
 namespace random
 {
 
+// Independent stream of random numbers.
+//
+// Streams constructed from the same seed and different ids are seeded apart,
+// so every worker, island or individual can draw from its own stream. Sequence
+// of a stream depends only on its seed and id, which makes runs reproducible.
+class Stream
+{
+public:
 #ifdef ECFCPP_USE_PCG
-static pcg32 randomGenerator{ pcg_extras::seed_seq_from< std::random_device >{} };
+    using Engine = pcg32;
 #else
-static std::mt19937 randomGenerator{ std::random_device{}() };
+    using Engine = Xoshiro256PlusPlus;
 #endif
 
-template< typename T, typename = std::enable_if_t< std::is_floating_point_v< T > > >
-inline auto normalDistribution();
+    explicit Stream( std::uint64_t const seed, std::uint64_t const id = 0 ) : engine_{ seed, id } {}
+
+    inline Engine & engine() noexcept { return engine_; }
+
+    // Draws seed for a family of substreams.
+    inline std::uint64_t nextSeed() noexcept { return bits(); }
+
+    // Creates stream which is independent of this one and of its other splits.
+    inline Stream split( std::uint64_t const id = 0 ) { return Stream{ nextSeed(), id }; }
+
+    // Draws 64 random bits.
+    inline std::uint64_t bits() noexcept
+    {
+        if constexpr ( std::numeric_limits< Engine::result_type >::digits < 64 )
+        {
+            std::uint64_t const high{ engine_() };
+            return high << 32 | engine_();
+        }
+        else
+        {
+            return engine_();
+        }
+    }
+
+    // Writes count random 64 bit words to out.
+    inline void bits( std::uint64_t * out, std::size_t const count ) noexcept
+    {
+#ifdef ECFCPP_USE_PCG
+        for ( std::size_t i{ 0 }; i < count; ++i )
+        {
+            out[ i ] = bits();
+        }
+#else
+        engine_.fill( out, count );
+#endif
+    }
+
+    // Draws number from [ 0, bound ) with Lemire's nearly divisionless method.
+    // Zero bound gives zero.
+    inline std::uint64_t bounded( std::uint64_t const bound ) noexcept
+    {
+        auto [ high, low ] = multiply( bits(), bound );
+        if ( low < bound )
+        {
+            auto const threshold{ -bound % bound };
+            while ( low < threshold )
+            {
+                std::tie( high, low ) = multiply( bits(), bound );
+            }
+        }
+        return high;
+    }
+
+    // Draws number from [ 0, 1 ).
+    template< typename T, typename = std::enable_if_t< std::is_floating_point_v< T > > >
+    inline T uniform() noexcept
+    {
+        return toUniform< T >( bits() );
+    }
+
+    // Fills values with numbers from [ 0, 1 ).
+    template< typename T, typename = std::enable_if_t< std::is_floating_point_v< T > > >
+    void uniform( Span< T > const values ) noexcept
+    {
+        std::array< std::uint64_t, 64 > chunk;
+        for ( std::size_t begin{ 0 }; begin < std::size( values ); begin += std::size( chunk ) )
+        {
+            auto const count{ std::min( std::size( chunk ), std::size( values ) - begin ) };
+            bits( chunk.data(), count );
+            for ( std::size_t i{ 0 }; i < count; ++i )
+            {
+                values[ begin + i ] = toUniform< T >( chunk[ i ] );
+            }
+        }
+    }
+
+    // Draws number from the standard normal distribution.
+    template< typename T, typename = std::enable_if_t< std::is_floating_point_v< T > > >
+    inline T normal() noexcept
+    {
+        return static_cast< T >( detail::ziggurat()( *this ) );
+    }
+
+private:
+    template< typename T >
+    static inline T toUniform( std::uint64_t const bits ) noexcept
+    {
+        if constexpr ( std::is_same_v< T, float > )
+        {
+            return static_cast< float >( bits >> 40 ) * 0x1.0p-24f;
+        }
+        else
+        {
+            return static_cast< T >( static_cast< double >( bits >> 11 ) * 0x1.0p-53 );
+        }
+    }
 
-template<>
-inline auto normalDistribution< float >()
+    // High and low half of the 128 bit product.
+    static inline std::pair< std::uint64_t, std::uint64_t > multiply( std::uint64_t const x, std::uint64_t const y ) noexcept
+    {
+#ifdef __SIZEOF_INT128__
+        __extension__ using Wide = unsigned __int128;
+        auto const product{ Wide{ x } * y };
+        return { static_cast< std::uint64_t >( product >> 64 ), static_cast< std::uint64_t >( product ) };
+#else
+        auto const xl{ x & 0xffffffff }, xh{ x >> 32 };
+        auto const yl{ y & 0xffffffff }, yh{ y >> 32 };
+        auto const ll{ xl * yl }, lh{ xl * yh }, hl{ xh * yl }, hh{ xh * yh };
+        auto const middle{ ( ll >> 32 ) + ( lh & 0xffffffff ) + ( hl & 0xffffffff ) };
+        return { hh + ( lh >> 32 ) + ( hl >> 32 ) + ( middle >> 32 ), x * y };
+#endif
+    }
+
+    Engine engine_;
+};
+
+namespace detail
 {
-    static std::normal_distribution< float > distribution{ 0, 1 };
-    return distribution( randomGenerator );
+
+inline std::atomic< std::uint64_t > & masterSeed() noexcept
+{
+    static std::atomic< std::uint64_t > seed
+    {
+        static_cast< std::uint64_t >( std::random_device{}() ) << 32 | std::random_device{}()
+    };
+    return seed;
 }
 
-template<>
-inline auto normalDistribution< double >()
+inline std::atomic< std::uint64_t > & nextStreamId() noexcept
 {
-    static std::normal_distribution< double > distribution{ 0, 1 };
-    return distribution( randomGenerator );
+    static std::atomic< std::uint64_t > id{ 0 };
+    return id;
 }
 
-template< typename T, typename = std::enable_if_t< std::is_floating_point_v< T > > >
-inline auto uniformDistribution();
+inline Stream & ownStream()
+{
+    thread_local Stream stream{ masterSeed().load(), nextStreamId().fetch_add( 1 ) };
+    return stream;
+}
+
+inline Stream * & currentStream() noexcept
+{
+    thread_local Stream * stream{ nullptr };
+    return stream;
+}
 
-template<>
-inline auto uniformDistribution< float >()
+}
+
+// Stream used by the calling thread. Unless replaced with ScopedStream, every
+// thread owns a stream derived from the master seed and the order in which
+// threads first drew a random number.
+inline Stream & stream()
 {
-    static std::uniform_real_distribution< float > distribution{ 0, 1 };
-    return distribution( randomGenerator );
+    auto * const current{ detail::currentStream() };
+    return current != nullptr ? *current : detail::ownStream();
 }
 
-template<>
-inline auto uniformDistribution< double >()
+// Sets the master seed and restarts the stream of the calling thread. Threads
+// drawing their first number afterwards get streams 1, 2, ... of the new seed.
+// Parallel code which must be reproducible should use ScopedStream instead of
+// relying on the order in which threads start.
+inline void seed( std::uint64_t const masterSeed )
 {
-    static std::uniform_real_distribution< double > distribution{ 0, 1 };
-    return distribution( randomGenerator );
+    // Stream of the calling thread must exist before ids restart, or its
+    // first use would take id 1.
+    auto & own{ detail::ownStream() };
+
+    detail::masterSeed().store( masterSeed );
+    detail::nextStreamId().store( 1 );
+    own = Stream{ masterSeed, 0 };
 }
 
+// Makes the calling thread draw from the given stream until destruction.
+class ScopedStream
+{
+public:
+    explicit ScopedStream( Stream stream ) :
+        stream_  { std::move( stream )      },
+        previous_{ detail::currentStream()  }
+    {
+        detail::currentStream() = &stream_;
+    }
+
+    ScopedStream( ScopedStream const & ) = delete;
+    ScopedStream( ScopedStream &&      ) = delete;
+
+    ScopedStream & operator=( ScopedStream const & ) = delete;
+    ScopedStream & operator=( ScopedStream &&      ) = delete;
+
+    ~ScopedStream() { detail::currentStream() = previous_; }
+
+    inline Stream & stream() noexcept { return stream_; }
+
+private:
+    Stream   stream_;
+    Stream * previous_;
+};
+
+template< typename T, typename = std::enable_if_t< std::is_floating_point_v< T > > >
+inline auto normalDistribution()
+{
+    return stream().normal< T >();
+}
+
+template< typename T, typename = std::enable_if_t< std::is_floating_point_v< T > > >
+inline auto uniformDistribution()
+{
+    return stream().uniform< T >();
+}
+
+// Integers are drawn from [ lower, upper ) without bias.
 template
 <
     typename T = decimal_t,
@@ -63,7 +261,17 @@ template
 inline T uniform( T const lower = 0, T const upper = 1 ) noexcept
 {
     auto const & [ min, max ] = std::minmax( lower, upper );
-    return static_cast< T >( min + uniformDistribution< Decimal >() * ( max - min ) );
+
+    if constexpr ( std::is_integral_v< T > )
+    {
+        using Unsigned = std::make_unsigned_t< T >;
+        auto const range{ static_cast< Unsigned >( static_cast< Unsigned >( max ) - static_cast< Unsigned >( min ) ) };
+        return static_cast< T >( static_cast< Unsigned >( min ) + static_cast< Unsigned >( stream().bounded( range ) ) );
+    }
+    else
+    {
+        return static_cast< T >( min + uniformDistribution< Decimal >() * ( max - min ) );
+    }
 }
 
 template
@@ -78,7 +286,50 @@ inline T normal( Decimal const mean = 0, Decimal const stddev = 1 ) noexcept
 
 inline bool boolean() noexcept
 {
-    return uniform( 0, 10 ) % 2;
+    return stream().bits() >> 63 != 0;
+}
+
+// Draws 64 random bits, one for every boolean of a block.
+inline std::uint64_t bits() noexcept
+{
+    return stream().bits();
+}
+
+// Fills values with numbers from [ lower, upper ).
+template< typename T, typename = std::enable_if_t< std::is_floating_point_v< T > > >
+inline void fillUniform( Span< T > const values, T const lower = 0, T const upper = 1 ) noexcept
+{
+    stream().uniform( values );
+
+    auto const & [ min, max ] = std::minmax( lower, upper );
+    if ( min != 0 || max != 1 )
+    {
+        for ( auto & value : values )
+        {
+            value = min + value * ( max - min );
+        }
+    }
+}
+
+// Fills values with numbers from [ lower, upper ), drawn without bias.
+inline void fillIndices( Span< std::size_t > const values, std::size_t const lower, std::size_t const upper ) noexcept
+{
+    auto & source{ stream() };
+    for ( auto & value : values )
+    {
+        value = lower + source.bounded( upper - lower );
+    }
+}
+
+// Draws count numbers from [ 0, 1 ) into a buffer owned by the calling thread,
+// valid until its next call with the same type on that thread.
+template< typename T, typename = std::enable_if_t< std::is_floating_point_v< T > > >
+inline Span< T const > uniforms( std::size_t const count )
+{
+    static thread_local std::vector< T > buffer;
+    buffer.resize( count );
+    stream().uniform( Span< T >{ buffer.data(), count } );
+    return { buffer.data(), count };
 }
 
 }
@@ -0,0 +1,105 @@
+#ifndef ECFCPP_UTILS_SPSC_QUEUE_HPP
+#define ECFCPP_UTILS_SPSC_QUEUE_HPP
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace ecfcpp::parallel
+{
+
+// Bounded lock-free queue of one producer thread and one consumer thread.
+// Capacity is rounded up to a power of two. Each side keeps its own copy of the
+// other side's index and reloads it only when the queue looks full or empty,
+// so most pushes and pops touch no shared cache line but the slot itself.
+template< typename T >
+class SpscQueue
+{
+    static_assert( std::is_trivially_copyable_v< T >, "Elements are copied in and out of slots." );
+
+public:
+    explicit SpscQueue( std::size_t const capacity ) :
+        mask_ { roundUp( capacity ) - 1               },
+        slots_{ std::make_unique< T[] >( mask_ + 1 ) }
+    {}
+
+    SpscQueue( SpscQueue const & ) = delete;
+    SpscQueue & operator=( SpscQueue const & ) = delete;
+
+    inline std::size_t capacity() const noexcept { return mask_ + 1; }
+
+    // Called by the producer. Returns false, leaving the queue as it was, if
+    // it is full.
+    inline bool push( T const & value ) noexcept
+    {
+        auto const tail{ producer_.tail };
+
+        if ( tail - producer_.head > mask_ )
+        {
+            producer_.head = head_.load( std::memory_order_acquire );
+            if ( tail - producer_.head > mask_ )
+            {
+                return false;
+            }
+        }
+
+        slots_[ tail & mask_ ] = value;
+        producer_.tail = tail + 1;
+        tail_.store( tail + 1, std::memory_order_release );
+        return true;
+    }
+
+    // Called by the consumer. Returns false if the queue is empty.
+    inline bool pop( T & value ) noexcept
+    {
+        auto const head{ consumer_.head };
+
+        if ( head == consumer_.tail )
+        {
+            consumer_.tail = tail_.load( std::memory_order_acquire );
+            if ( head == consumer_.tail )
+            {
+                return false;
+            }
+        }
+
+        value = slots_[ head & mask_ ];
+        consumer_.head = head + 1;
+        head_.store( head + 1, std::memory_order_release );
+        return true;
+    }
+
+private:
+    static constexpr std::size_t cacheLine{ 64 };
+
+    static std::size_t roundUp( std::size_t const capacity ) noexcept
+    {
+        assert( capacity > 0 );
+
+        std::size_t result{ 1 };
+        while ( result < capacity )
+        {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    struct Indices
+    {
+        std::size_t head{ 0 };
+        std::size_t tail{ 0 };
+    };
+
+    std::size_t            const                    mask_;
+    std::unique_ptr< T[] > const                    slots_;
+    alignas( cacheLine ) std::atomic< std::size_t > head_    { 0 };
+    alignas( cacheLine ) std::atomic< std::size_t > tail_    { 0 };
+    alignas( cacheLine ) Indices                    producer_;
+    alignas( cacheLine ) Indices                    consumer_;
+};
+
+}
+
+#endif // ECFCPP_UTILS_SPSC_QUEUE_HPP
@@ -0,0 +1,267 @@
+#ifndef ECFCPP_UTILS_THREAD_POOL_HPP
+#define ECFCPP_UTILS_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace ecfcpp::parallel
+{
+
+// Pool of worker threads which executes chunked parallel loops.
+//
+// Chunks of a loop are split evenly between the participants (workers and the
+// calling thread) up front. Participants take chunks from the front of their own
+// queue and, once it is empty, steal chunks from the back of other queues, so
+// the load stays balanced even if the cost of an iteration varies.
+//
+// Loops submitted from different threads are executed one after another.
+// Submitting a loop from inside a loop running on the same pool deadlocks.
+class ThreadPool
+{
+public:
+    explicit ThreadPool( std::size_t const threadCount = std::thread::hardware_concurrency() ) :
+        queues_( std::max( threadCount, std::size_t{ 1 } ) )
+    {
+        workers_.reserve( std::size( queues_ ) - 1 );
+        for ( std::size_t i{ 1 }; i < std::size( queues_ ); ++i )
+        {
+            workers_.emplace_back( [ this, i ](){ work( i ); } );
+        }
+    }
+
+    ThreadPool( ThreadPool const & ) = delete;
+    ThreadPool( ThreadPool &&      ) = delete;
+
+    ThreadPool & operator=( ThreadPool const & ) = delete;
+    ThreadPool & operator=( ThreadPool &&      ) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard< std::mutex > const lock{ mutex_ };
+            stop_ = true;
+        }
+        wake_.notify_all();
+
+        for ( auto & worker : workers_ )
+        {
+            worker.join();
+        }
+    }
+
+    // Number of threads executing a loop, including the calling thread.
+    inline std::size_t size() const noexcept { return std::size( queues_ ); }
+
+    // Calls function( begin, end ) for consecutive chunks of [0, count) and returns
+    // once all of them are processed. Chunk size of 0 picks a size which gives every
+    // thread a few chunks to steal. The first exception thrown by function is
+    // rethrown to the caller.
+    template< typename Function >
+    void forEachChunk( std::size_t const count, std::size_t const chunkSize, Function && function )
+    {
+        if ( count == 0 )
+        {
+            return;
+        }
+
+        std::lock_guard< std::mutex > const submitLock{ submitMutex_ };
+
+        chunkSize_ = chunkSize > 0 ? chunkSize : std::max( count / ( 4 * size() ), std::size_t{ 1 } );
+        count_     = count;
+        function_  = const_cast< void * >( static_cast< void const * >( std::addressof( function ) ) );
+        invoke_    = []( void * const f, std::size_t const begin, std::size_t const end )
+        {
+            ( *static_cast< std::remove_reference_t< Function > * >( f ) )( begin, end );
+        };
+        exception_ = nullptr;
+
+        auto const chunkCount{ ( count + chunkSize_ - 1 ) / chunkSize_ };
+        assert( chunkCount <= std::numeric_limits< std::uint32_t >::max() );
+
+        remaining_.store( chunkCount, std::memory_order_relaxed );
+        for ( std::size_t i{ 0 }; i < size(); ++i )
+        {
+            queues_[ i ].store
+            (
+                pack( i * chunkCount / size(), ( i + 1 ) * chunkCount / size() ),
+                std::memory_order_release
+            );
+        }
+
+        {
+            std::lock_guard< std::mutex > const lock{ mutex_ };
+            ++generation_;
+        }
+        wake_.notify_all();
+
+        drain( 0 );
+
+        {
+            std::unique_lock< std::mutex > lock{ mutex_ };
+            done_.wait( lock, [ this ](){ return remaining_.load( std::memory_order_acquire ) == 0; } );
+        }
+
+        if ( exception_ )
+        {
+            std::rethrow_exception( exception_ );
+        }
+    }
+
+    // Calls function( i ) for every i in [0, count).
+    template< typename Function >
+    void forEach( std::size_t const count, std::size_t const chunkSize, Function && function )
+    {
+        forEachChunk
+        (
+            count,
+            chunkSize,
+            [ & function ]( std::size_t const begin, std::size_t const end )
+            {
+                for ( std::size_t i{ begin }; i < end; ++i )
+                {
+                    function( i );
+                }
+            }
+        );
+    }
+
+private:
+    // Queue of a participant is a range of chunk indices [front, back) packed into a
+    // single word, so the owner and the thieves can claim chunks with one CAS.
+    using Queue = std::atomic< std::uint64_t >;
+
+    static constexpr inline std::uint64_t pack( std::uint64_t const front, std::uint64_t const back ) noexcept
+    {
+        return front << 32 | back;
+    }
+
+    static constexpr inline std::uint64_t front( std::uint64_t const queue ) noexcept { return queue >> 32;         }
+    static constexpr inline std::uint64_t back ( std::uint64_t const queue ) noexcept { return queue & 0xFFFFFFFFU; }
+
+    bool popFront( Queue & queue, std::uint64_t & chunk ) noexcept
+    {
+        auto current{ queue.load( std::memory_order_acquire ) };
+        while ( front( current ) < back( current ) )
+        {
+            if ( queue.compare_exchange_weak( current, pack( front( current ) + 1, back( current ) ), std::memory_order_acq_rel ) )
+            {
+                chunk = front( current );
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool popBack( Queue & queue, std::uint64_t & chunk ) noexcept
+    {
+        auto current{ queue.load( std::memory_order_acquire ) };
+        while ( front( current ) < back( current ) )
+        {
+            if ( queue.compare_exchange_weak( current, pack( front( current ), back( current ) - 1 ), std::memory_order_acq_rel ) )
+            {
+                chunk = back( current ) - 1;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void run( std::uint64_t const chunk ) noexcept
+    {
+        auto const begin{ chunk * chunkSize_ };
+        auto const end  { std::min( begin + chunkSize_, count_ ) };
+
+        try
+        {
+            invoke_( function_, begin, end );
+        }
+        catch ( ... )
+        {
+            std::lock_guard< std::mutex > const lock{ exceptionMutex_ };
+            if ( !exception_ )
+            {
+                exception_ = std::current_exception();
+            }
+        }
+
+        if ( remaining_.fetch_sub( 1, std::memory_order_acq_rel ) == 1 )
+        {
+            std::lock_guard< std::mutex > const lock{ mutex_ };
+            done_.notify_all();
+        }
+    }
+
+    void drain( std::size_t const self ) noexcept
+    {
+        std::uint64_t chunk{ 0 };
+
+        while ( popFront( queues_[ self ], chunk ) )
+        {
+            run( chunk );
+        }
+
+        for ( std::size_t i{ 1 }; i < size(); ++i )
+        {
+            auto & victim{ queues_[ ( self + i ) % size() ] };
+            while ( popBack( victim, chunk ) )
+            {
+                run( chunk );
+            }
+        }
+    }
+
+    void work( std::size_t const self ) noexcept
+    {
+        std::uint64_t seen{ 0 };
+
+        while ( true )
+        {
+            {
+                std::unique_lock< std::mutex > lock{ mutex_ };
+                wake_.wait( lock, [ this, seen ](){ return stop_ || generation_ != seen; } );
+                if ( stop_ )
+                {
+                    return;
+                }
+                seen = generation_;
+            }
+
+            drain( self );
+        }
+    }
+
+    std::vector< Queue       > queues_;
+    std::vector< std::thread > workers_;
+
+    std::mutex              submitMutex_;
+    std::mutex              mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    std::uint64_t           generation_{ 0 };
+    bool                    stop_{ false };
+
+    std::atomic< std::size_t > remaining_{ 0 };
+    std::size_t                count_{ 0 };
+    std::size_t                chunkSize_{ 1 };
+    void                     * function_{ nullptr };
+    void                    ( *invoke_ )( void *, std::size_t, std::size_t ){ nullptr };
+
+    std::mutex         exceptionMutex_;
+    std::exception_ptr exception_;
+};
+
+}
+
+#endif // ECFCPP_UTILS_THREAD_POOL_HPP
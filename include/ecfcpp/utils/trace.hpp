@@ -0,0 +1,188 @@
+#ifndef ECFCPP_UTILS_TRACE_HPP
+#define ECFCPP_UTILS_TRACE_HPP
+
+#include <ecfcpp/utils/spsc_queue.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ios>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ecfcpp::trace
+{
+
+// Fixed-size record of one generation of a run.
+struct Record
+{
+    std::uint64_t generation;
+    std::uint64_t elapsed; // nanoseconds since the run started
+    double        best;
+    double        diversity;
+};
+
+static_assert( sizeof( Record ) == 32, "Binary traces hold records as they are laid out in memory." );
+
+enum class Format : std::uint8_t
+{
+    Binary,
+    Csv
+};
+
+// Binary traces start with this header, followed by records in the byte order
+// of the machine which wrote them.
+struct Header
+{
+    char          magic[ 8 ]{ 'E', 'C', 'F', 'T', 'R', 'A', 'C', 'E' };
+    std::uint32_t version   { 1                                      };
+    std::uint32_t recordSize{ sizeof( Record )                       };
+};
+
+inline void writeCsvHeader( std::ostream & stream )
+{
+    stream << "generation,elapsed_ns,best_fitness,diversity\n";
+}
+
+inline void writeCsv( std::ostream & stream, Record const & record )
+{
+    stream << record.generation << ',' << record.elapsed << ',' << record.best << ',' << record.diversity << '\n';
+}
+
+// Appends records of a binary trace in stream to records. Returns false if
+// stream does not start with a header of this version.
+inline bool read( std::istream & stream, std::vector< Record > & records )
+{
+    Header const expected;
+    Header       header;
+
+    if
+    (
+        !stream.read( reinterpret_cast< char * >( &header ), sizeof( header ) ) ||
+        std::memcmp( header.magic, expected.magic, sizeof( header.magic ) ) != 0 ||
+        header.version    != expected.version                                    ||
+        header.recordSize != expected.recordSize
+    )
+    {
+        return false;
+    }
+
+    Record record;
+    while ( stream.read( reinterpret_cast< char * >( &record ), sizeof( record ) ) )
+    {
+        records.push_back( record );
+    }
+    return true;
+}
+
+// Writes records to a file on a background thread. The thread producing
+// records hands them over through a lock-free queue, so a push costs a copy
+// into the queue, unless the writer falls so far behind that the queue is
+// full; the producer then yields until there is room, and records are never
+// lost. Records still queued are written when the writer is destroyed.
+class Writer
+{
+public:
+    explicit Writer( std::string const & path, Format const format = Format::Binary, std::size_t const capacity = 1 << 16 ) :
+        queue_ { capacity                                                                         },
+        file_  { path, format == Format::Binary ? std::ios::binary | std::ios::out : std::ios::out },
+        format_{ format                                                                           }
+    {
+        if ( format_ == Format::Binary )
+        {
+            Header const header;
+            file_.write( reinterpret_cast< char const * >( &header ), sizeof( header ) );
+        }
+        else
+        {
+            file_.precision( 17 );
+            writeCsvHeader( file_ );
+        }
+
+        thread_ = std::thread{ [ this ](){ drain(); } };
+    }
+
+    Writer( Writer const & ) = delete;
+    Writer( Writer &&      ) = delete;
+
+    Writer & operator=( Writer const & ) = delete;
+    Writer & operator=( Writer &&      ) = delete;
+
+    ~Writer()
+    {
+        stop_.store( true, std::memory_order_release );
+        thread_.join();
+    }
+
+    // Called by a single producer thread.
+    inline void push( Record const & record ) noexcept
+    {
+        while ( !queue_.push( record ) )
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    // Whether the file could be opened. Later write errors are not reported.
+    inline bool good() const noexcept { return opened_; }
+
+private:
+    void drain()
+    {
+        Record record;
+
+        for ( ;; )
+        {
+            // Records pushed before stopping are all in the queue by now.
+            auto const stopping{ stop_.load( std::memory_order_acquire ) };
+
+            bool drained{ false };
+            while ( queue_.pop( record ) )
+            {
+                drained = true;
+                write( record );
+            }
+
+            if ( stopping )
+            {
+                break;
+            }
+
+            if ( !drained )
+            {
+                std::this_thread::sleep_for( std::chrono::milliseconds{ 1 } );
+            }
+        }
+
+        file_.flush();
+    }
+
+    inline void write( Record const & record )
+    {
+        if ( format_ == Format::Binary )
+        {
+            file_.write( reinterpret_cast< char const * >( &record ), sizeof( record ) );
+        }
+        else
+        {
+            writeCsv( file_, record );
+        }
+    }
+
+    parallel::SpscQueue< Record > queue_;
+    std::ofstream                 file_;
+    Format                        format_;
+    bool                          opened_{ file_.is_open() };
+    std::atomic< bool >           stop_  { false            };
+    std::thread                   thread_;
+};
+
+}
+
+#endif // ECFCPP_UTILS_TRACE_HPP
@@ -1 +1,6 @@
+#include "aligned_allocator.hpp"
+#include "checkpoint.hpp"
 #include "random.hpp"
+#include "spsc_queue.hpp"
+#include "thread_pool.hpp"
+#include "trace.hpp"
@@ -0,0 +1,130 @@
+#ifndef ECFCPP_UTILS_XOSHIRO_HPP
+#define ECFCPP_UTILS_XOSHIRO_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+
+namespace ecfcpp::random
+{
+
+// Four xoshiro256++ generators running side by side. Their states are stored
+// lane by lane, so one step advances all of them in a loop which compilers turn
+// into vector instructions, and outputs are handed out from a block of several
+// steps. Satisfies UniformRandomBitGenerator.
+class Xoshiro256PlusPlus
+{
+public:
+    using result_type = std::uint64_t;
+
+    static constexpr std::size_t lanes{ 4 };
+    static constexpr std::size_t steps{ 8 };
+
+    Xoshiro256PlusPlus( std::uint64_t const seed, std::uint64_t const id = 0 ) noexcept
+    {
+        // State is expanded from seed and id with splitmix64, as advised by the
+        // authors of xoshiro.
+        std::uint64_t state{ seed };
+        state = splitMix64( state ) ^ mix( id );
+
+        for ( auto * word : { &s0_, &s1_, &s2_, &s3_ } )
+        {
+            for ( auto & lane : *word )
+            {
+                lane = splitMix64( state );
+            }
+        }
+    }
+
+    static constexpr result_type min() noexcept { return std::numeric_limits< result_type >::min(); }
+    static constexpr result_type max() noexcept { return std::numeric_limits< result_type >::max(); }
+
+    inline result_type operator()() noexcept
+    {
+        if ( position_ == std::size( block_ ) )
+        {
+            for ( std::size_t i{ 0 }; i < steps; ++i )
+            {
+                step( block_.data() + i * lanes );
+            }
+            position_ = 0;
+        }
+        return block_[ position_++ ];
+    }
+
+    // Writes next count outputs to out, the same ones count calls would return.
+    void fill( result_type * out, std::size_t count ) noexcept
+    {
+        auto const buffered{ std::min( count, std::size( block_ ) - position_ ) };
+        out = std::copy_n( block_.data() + position_, buffered, out );
+        position_ += buffered;
+        count     -= buffered;
+
+        for ( ; count >= lanes; count -= lanes, out += lanes )
+        {
+            step( out );
+        }
+
+        for ( ; count > 0; --count )
+        {
+            *out++ = ( *this )();
+        }
+    }
+
+private:
+    static constexpr std::uint64_t rotl( std::uint64_t const x, int const k ) noexcept
+    {
+        return ( x << k ) | ( x >> ( 64 - k ) );
+    }
+
+    static constexpr std::uint64_t mix( std::uint64_t z ) noexcept
+    {
+        z = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9;
+        z = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111eb;
+        return z ^ ( z >> 31 );
+    }
+
+    static constexpr std::uint64_t splitMix64( std::uint64_t & state ) noexcept
+    {
+        state += 0x9e3779b97f4a7c15;
+        return mix( state );
+    }
+
+    inline void step( result_type * const out ) noexcept
+    {
+        // Outputs go through a local array, which cannot alias the state.
+        std::array< result_type, lanes > result;
+
+        for ( std::size_t i{ 0 }; i < lanes; ++i )
+        {
+            result[ i ] = rotl( s0_[ i ] + s3_[ i ], 23 ) + s0_[ i ];
+
+            auto const t{ s1_[ i ] << 17 };
+
+            s2_[ i ] ^= s0_[ i ];
+            s3_[ i ] ^= s1_[ i ];
+            s1_[ i ] ^= s2_[ i ];
+            s0_[ i ] ^= s3_[ i ];
+
+            s2_[ i ] ^= t;
+            s3_[ i ]  = rotl( s3_[ i ], 45 );
+        }
+
+        std::copy( std::begin( result ), std::end( result ), out );
+    }
+
+    std::array< std::uint64_t, lanes > s0_;
+    std::array< std::uint64_t, lanes > s1_;
+    std::array< std::uint64_t, lanes > s2_;
+    std::array< std::uint64_t, lanes > s3_;
+
+    std::array< result_type, lanes * steps > block_;
+    std::size_t position_{ lanes * steps };
+};
+
+}
+
+#endif // ECFCPP_UTILS_XOSHIRO_HPP
@@ -0,0 +1,91 @@
+#ifndef ECFCPP_UTILS_ZIGGURAT_HPP
+#define ECFCPP_UTILS_ZIGGURAT_HPP
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace ecfcpp::random::detail
+{
+
+// Marsaglia and Tsang's ziggurat for the standard normal distribution. The
+// density is covered by layers of equal area; a draw lands inside the density
+// with one random number and one comparison almost every time.
+class Ziggurat
+{
+public:
+    static constexpr std::size_t layers{ 256                };
+    static constexpr double      tail  { 3.6541528853610088 };
+    static constexpr double      area  { 0.00492867323399   };
+
+    Ziggurat() noexcept
+    {
+        x_[ 0 ] = area / density( tail );
+        x_[ 1 ] = tail;
+        for ( std::size_t i{ 1 }; i + 1 < layers; ++i )
+        {
+            x_[ i + 1 ] = std::sqrt( -2 * std::log( area / x_[ i ] + density( x_[ i ] ) ) );
+        }
+        x_[ layers ] = 0;
+
+        for ( std::size_t i{ 0 }; i <= layers; ++i )
+        {
+            y_[ i ] = density( x_[ i ] );
+        }
+    }
+
+    // Source must provide bits() and uniform< double >().
+    template< typename Source >
+    double operator()( Source & source ) const noexcept
+    {
+        while ( true )
+        {
+            auto const bits { source.bits() };
+            auto const layer{ bits & ( layers - 1 ) };
+
+            // Bits above the layer make a uniform number from [ -1, 1 ).
+            auto const u{ static_cast< double >( bits >> 11 ) * 0x1.0p-52 - 1 };
+            auto const x{ u * x_[ layer ] };
+
+            if ( std::abs( x ) < x_[ layer + 1 ] )
+            {
+                return x;
+            }
+
+            if ( layer == 0 )
+            {
+                double a, b;
+                do
+                {
+                    a = -std::log( 1 - source.template uniform< double >() ) / tail;
+                    b = -std::log( 1 - source.template uniform< double >() );
+                } while ( b + b < a * a );
+
+                return u < 0 ? -( tail + a ) : tail + a;
+            }
+
+            auto const y{ y_[ layer ] + ( y_[ layer + 1 ] - y_[ layer ] ) * source.template uniform< double >() };
+            if ( y < density( x ) )
+            {
+                return x;
+            }
+        }
+    }
+
+private:
+    static double density( double const x ) noexcept { return std::exp( -x * x / 2 ); }
+
+    std::array< double, layers + 1 > x_;
+    std::array< double, layers + 1 > y_;
+};
+
+inline Ziggurat const & ziggurat() noexcept
+{
+    static Ziggurat const table;
+    return table;
+}
+
+}
+
+#endif // ECFCPP_UTILS_ZIGGURAT_HPP
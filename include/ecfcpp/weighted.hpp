@@ -0,0 +1,134 @@
+#ifndef ECFCPP_WEIGHTED_HPP
+#define ECFCPP_WEIGHTED_HPP
+
+#include <ecfcpp/types.hpp>
+#include <ecfcpp/utils/random.hpp>
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ecfcpp
+{
+
+// Operator of a composite with the weight by which it is chosen, relative to
+// the weights of other operators in the composite. Unwrapped operators weigh
+// one.
+template< typename Operator >
+struct Weighted
+{
+    constexpr Weighted( Operator operation, decimal_t const weight ) : op{ std::move( operation ) }, weight{ weight } {}
+
+    Operator  op;
+    decimal_t weight;
+};
+
+namespace detail
+{
+
+template< typename T >
+struct Unweighted
+{
+    using type = T;
+
+    static constexpr T const & op    ( T const & op ) noexcept { return op; }
+    static constexpr decimal_t weight( T const &    ) noexcept { return 1;  }
+};
+
+template< typename Operator >
+struct Unweighted< Weighted< Operator > >
+{
+    using type = Operator;
+
+    static constexpr Operator const & op    ( Weighted< Operator > const & weighted ) noexcept { return weighted.op;     }
+    static constexpr decimal_t        weight( Weighted< Operator > const & weighted ) noexcept { return weighted.weight; }
+};
+
+template< typename T >
+using unweighted_t = typename Unweighted< std::remove_cv_t< std::remove_reference_t< T > > >::type;
+
+template< typename T >
+constexpr decltype( auto ) unweighted( T const & operatorOrWeighted ) noexcept
+{
+    return Unweighted< T >::op( operatorOrWeighted );
+}
+
+template< typename T >
+constexpr decimal_t weightOf( T const & operatorOrWeighted ) noexcept
+{
+    return Unweighted< T >::weight( operatorOrWeighted );
+}
+
+// Chooses one of N alternatives with probabilities proportional to weights,
+// from cumulative probabilities computed once.
+template< std::size_t N >
+class WeightTable
+{
+public:
+    constexpr WeightTable( std::array< decimal_t, N > const & weights ) noexcept
+    {
+        decimal_t sum{ 0 };
+        for ( auto const weight : weights )
+        {
+            assert( weight >= 0 );
+            sum += weight;
+        }
+        assert( sum > 0 );
+
+        decimal_t cumulative{ 0 };
+        for ( std::size_t i{ 0 }; i < N; ++i )
+        {
+            cumulative      += weights[ i ];
+            cumulative_[ i ] = cumulative / sum;
+        }
+    }
+
+    inline std::size_t choose() const noexcept
+    {
+        auto const randomValue{ random::uniform< decimal_t >() };
+
+        std::size_t i{ 0 };
+        while ( i + 1 < N && !( randomValue < cumulative_[ i ] ) )
+        {
+            ++i;
+        }
+        return i;
+    }
+
+    // Probability of choosing alternative i.
+    constexpr decimal_t probability( std::size_t const i ) const noexcept
+    {
+        return i == 0 ? cumulative_[ 0 ] : cumulative_[ i ] - cumulative_[ i - 1 ];
+    }
+
+private:
+    std::array< decimal_t, N > cumulative_{};
+};
+
+// Calls function with element index of operators. Every call is direct, so the
+// chosen operator can be inlined.
+template< std::size_t I = 0, typename Tuple, typename Function >
+constexpr decltype( auto ) visit( Tuple & operators, std::size_t const index, Function && function )
+{
+    if constexpr ( I + 1 == std::tuple_size_v< std::remove_const_t< Tuple > > )
+    {
+        return function( std::get< I >( operators ) );
+    }
+    else
+    {
+        if ( index == I )
+        {
+            return function( std::get< I >( operators ) );
+        }
+        return visit< I + 1 >( operators, index, std::forward< Function >( function ) );
+    }
+}
+
+}
+
+}
+
+#endif // ECFCPP_WEIGHTED_HPP
@@ -0,0 +1,109 @@
+#include "check.hpp"
+
+#include <ecfcpp/ecfcpp.hpp>
+
+namespace
+{
+
+using Chromosome = ecfcpp::Array< double, 10 >;
+
+// Runs of an engine with the same seed and the same adaptive composite give
+// the same result, however many runs the composite was used for before.
+template< typename Run >
+void independentRuns( Run const & run )
+{
+    ecfcpp::crossover::Composite const crossover
+    {
+        ecfcpp::AdaptivePursuit{},
+        ecfcpp::crossover::BlxAlpha{ 0.2f },
+        ecfcpp::crossover::Arithmetical{ 0.4f }
+    };
+
+    ecfcpp::random::seed( 7 );
+    auto const first{ run( crossover ) };
+    auto const probability{ crossover.probability( 0 ) };
+
+    ecfcpp::random::seed( 7 );
+    auto const second{ run( crossover ) };
+
+    CHECK( first.fitness == second.fitness );
+    CHECK( crossover.probability( 0 ) == probability );
+
+    crossover.reset();
+    CHECK( crossover.probability( 0 ) == 0.5f );
+}
+
+// Pursuit moves towards the operator whose offspring improve on their parents,
+// wherever it is in the composite, and leaves probabilities alone while no
+// operator stands out.
+void pursuit()
+{
+    ecfcpp::crossover::Composite const crossover
+    {
+        ecfcpp::AdaptivePursuit{},
+        ecfcpp::crossover::BlxAlpha{ 0.2f },
+        ecfcpp::crossover::Arithmetical{ 0.4f }
+    };
+
+    auto const generations
+    {
+        [ & ]( double const first, double const second )
+        {
+            for ( int generation{ 0 }; generation < 5; ++generation )
+            {
+                for ( int i{ 0 }; i < 10; ++i )
+                {
+                    crossover.reward( 0, first  );
+                    crossover.reward( 1, second );
+                }
+                crossover.adapt();
+            }
+        }
+    };
+
+    generations( 0, -1 );
+    CHECK( crossover.probability( 0 ) == 0.5f );
+
+    generations( 1, 1 );
+    CHECK( crossover.probability( 0 ) == 0.5f );
+
+    crossover.reset();
+    generations( -1, 0.5 );
+    CHECK( crossover.probability( 1 ) > 0.8f );
+}
+
+}
+
+int main()
+{
+    auto const function{ ecfcpp::function::rastrigin< Chromosome > };
+    ecfcpp::problem::Minimization const problem{ function };
+    ecfcpp::selection::Tournament const selection{ 3 };
+    ecfcpp::mutation::Gaussian const mutation{ 0.1f, true, 0.3f };
+
+    ecfcpp::random::seed( 1 );
+    auto const population
+    {
+        ecfcpp::factory::create( Chromosome{ -5, 5 }, 40, [](){ return ecfcpp::random::uniform( -5., 5. ); } )
+    };
+
+    independentRuns
+    (
+        [ & ]( auto const & crossover )
+        {
+            return ecfcpp::ga::generational( true, 50, 0, 1e-9, problem, selection, crossover, mutation, population );
+        }
+    );
+
+    independentRuns
+    (
+        [ & ]( auto const & crossover )
+        {
+            return ecfcpp::ga::steady_state( 0.2f, 50, 0, 1e-9, problem, selection, crossover, mutation, population );
+        }
+    );
+
+    pursuit();
+
+    return check::result();
+}
@@ -0,0 +1,87 @@
+#include "check.hpp"
+
+#include <ecfcpp/bit_vector.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+
+using Word = std::uint64_t;
+
+constexpr std::size_t size{ 150 };
+
+// Bits read one at a time, as bits() is documented to read them.
+Word reference( ecfcpp::BitVector const & vector, std::size_t const position, std::size_t const count )
+{
+    Word result{ 0 };
+    for ( std::size_t i{ 0 }; i < count; ++i )
+    {
+        result |= Word{ vector[ position + i ] } << i;
+    }
+    return result;
+}
+
+ecfcpp::BitVector pattern()
+{
+    ecfcpp::BitVector vector( size );
+    for ( std::size_t i{ 0 }; i < size; ++i )
+    {
+        vector[ i ] = ( i * 7 + i / 3 ) % 5 < 2;
+    }
+    return vector;
+}
+
+// Every field, including ones straddling a word boundary and whole words at
+// an offset.
+void bits()
+{
+    auto const vector{ pattern() };
+
+    for ( std::size_t count{ 0 }; count <= 64; ++count )
+    {
+        for ( std::size_t position{ 0 }; position + count <= size; ++position )
+        {
+            CHECK( vector.bits( position, count ) == reference( vector, position, count ) );
+        }
+    }
+}
+
+// Writing a field changes exactly its bits, reads back, and leaves the bits
+// past size() zero.
+void setBits()
+{
+    Word const value{ 0x9e3779b97f4a7c15 };
+
+    for ( std::size_t count{ 0 }; count <= 64; ++count )
+    {
+        for ( std::size_t position{ 0 }; position + count <= size; ++position )
+        {
+            auto const before{ pattern() };
+            auto       after { before    };
+            after.setBits( position, count, value );
+
+            auto const mask{ count == 64 ? ~Word{ 0 } : ( Word{ 1 } << count ) - 1 };
+            CHECK( after.bits( position, count ) == ( value & mask ) );
+
+            bool untouched{ true };
+            for ( std::size_t i{ 0 }; i < size; ++i )
+            {
+                untouched = untouched && ( ( i >= position && i < position + count ) || after[ i ] == before[ i ] );
+            }
+            CHECK( untouched );
+            CHECK( after.words()[ after.wordCount() - 1 ] >> size % 64 == 0 );
+        }
+    }
+}
+
+}
+
+int main()
+{
+    bits   ();
+    setBits();
+
+    return check::result();
+}
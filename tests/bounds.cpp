@@ -0,0 +1,113 @@
+#include "check.hpp"
+
+#include <ecfcpp/bounded_array.hpp>
+#include <ecfcpp/bounds.hpp>
+
+#include <cstdint>
+#include <limits>
+
+namespace
+{
+
+template< typename Bound, typename T >
+T repaired( T value, T const lower, T const upper )
+{
+    Bound{}( &value, &value + 1, lower, upper );
+    return value;
+}
+
+// Integer genes bounded by the whole type never leave their bounds, and the
+// policies must not overflow computing that.
+template< typename T >
+void wholeType()
+{
+    using Limits = std::numeric_limits< T >;
+
+    ecfcpp::BoundedArray< T, 3, ecfcpp::bound::Wrap    > wrapped;
+    ecfcpp::BoundedArray< T, 3, ecfcpp::bound::Reflect > reflected;
+
+    wrapped  [ 0 ] = Limits::min(); wrapped  [ 1 ] = Limits::max(); wrapped  [ 2 ] = T{ 1 };
+    reflected[ 0 ] = Limits::min(); reflected[ 1 ] = Limits::max(); reflected[ 2 ] = T{ 1 };
+    wrapped  .repair();
+    reflected.repair();
+
+    CHECK( wrapped  [ 0 ] == Limits::min() && wrapped  [ 1 ] == Limits::max() && wrapped  [ 2 ] == T{ 1 } );
+    CHECK( reflected[ 0 ] == Limits::min() && reflected[ 1 ] == Limits::max() && reflected[ 2 ] == T{ 1 } );
+}
+
+// Bounds one short of the whole type at either end.
+template< typename T >
+void nearlyWholeType()
+{
+    using Limits = std::numeric_limits< T >;
+
+    T const lower( Limits::min() + 1 );
+
+    CHECK( repaired< ecfcpp::bound::Wrap    >( Limits::min(), lower, Limits::max() ) == Limits::max() );
+    CHECK( repaired< ecfcpp::bound::Reflect >( Limits::min(), lower, Limits::max() ) == T( lower + 1 ) );
+    CHECK( repaired< ecfcpp::bound::Clamp   >( Limits::min(), lower, Limits::max() ) == lower );
+}
+
+void narrow()
+{
+    // Period of [ -2, 3 ] is 6 integers, the width 5.
+    CHECK( repaired< ecfcpp::bound::Wrap >(  4, -2, 3 ) == -2 );
+    CHECK( repaired< ecfcpp::bound::Wrap >( -3, -2, 3 ) ==  3 );
+    CHECK( repaired< ecfcpp::bound::Wrap >( 10, -2, 3 ) == -2 );
+    CHECK( repaired< ecfcpp::bound::Wrap >( -9, -2, 3 ) ==  3 );
+
+    CHECK( repaired< ecfcpp::bound::Reflect >(   4, -2, 3 ) ==  2 );
+    CHECK( repaired< ecfcpp::bound::Reflect >(  -4, -2, 3 ) ==  0 );
+    CHECK( repaired< ecfcpp::bound::Reflect >(   8, -2, 3 ) == -2 );
+    CHECK( repaired< ecfcpp::bound::Reflect >(   9, -2, 3 ) == -1 );
+    CHECK( repaired< ecfcpp::bound::Reflect >( -12, -2, 3 ) == -2 );
+
+    CHECK( repaired< ecfcpp::bound::Wrap    >( 7, 5, 5 ) == 5 );
+    CHECK( repaired< ecfcpp::bound::Reflect >( 7, 5, 5 ) == 5 );
+
+    CHECK( repaired< ecfcpp::bound::Wrap    >( std::uint8_t{ 0   }, std::uint8_t{ 1 }, std::uint8_t{ 250 } ) == 250 );
+    CHECK( repaired< ecfcpp::bound::Reflect >( std::uint8_t{ 255 }, std::uint8_t{ 1 }, std::uint8_t{ 250 } ) == 245 );
+}
+
+// Resampled integer genes cover both bounds, also of the whole type.
+void resample()
+{
+    bool seen[ 4 ]{};
+    for ( int i{ 0 }; i < 1000; ++i )
+    {
+        auto const value{ repaired< ecfcpp::bound::Resample >( 9, 0, 3 ) };
+        CHECK( 0 <= value && value <= 3 );
+        seen[ value ] = true;
+    }
+    CHECK( seen[ 0 ] && seen[ 1 ] && seen[ 2 ] && seen[ 3 ] );
+
+    bool upper{ false };
+    for ( int i{ 0 }; i < 1000; ++i )
+    {
+        upper = upper || repaired< ecfcpp::bound::Resample >( std::uint8_t{ 0 }, std::uint8_t{ 254 }, std::uint8_t{ 255 } ) == 255;
+    }
+    CHECK( upper );
+
+    using Limits = std::numeric_limits< std::int64_t >;
+    CHECK( repaired< ecfcpp::bound::Resample >( Limits::min(), Limits::min() + 1, Limits::max() ) != Limits::min() );
+}
+
+}
+
+int main()
+{
+    wholeType< std::int8_t   >();
+    wholeType< std::int16_t  >();
+    wholeType< int           >();
+    wholeType< long long     >();
+    wholeType< unsigned      >();
+    wholeType< std::uint64_t >();
+
+    nearlyWholeType< int       >();
+    nearlyWholeType< long long >();
+
+    narrow();
+    resample();
+
+    return check::result();
+}
@@ -0,0 +1,36 @@
+#ifndef ECFCPP_TESTS_CHECK_HPP
+#define ECFCPP_TESTS_CHECK_HPP
+
+#include <cstdlib>
+#include <iostream>
+
+// Minimal checks for the test executables, which report every failed
+// condition and exit with failure if there was any.
+namespace check
+{
+
+inline int & failures() noexcept
+{
+    static int count{ 0 };
+    return count;
+}
+
+inline void expect( bool const condition, char const * const expression, char const * const file, int const line )
+{
+    if ( !condition )
+    {
+        ++failures();
+        std::cerr << file << ':' << line << ": check failed: " << expression << '\n';
+    }
+}
+
+inline int result() noexcept
+{
+    return failures() == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+}
+
+#define CHECK( condition ) ::check::expect( ( condition ), #condition, __FILE__, __LINE__ )
+
+#endif // ECFCPP_TESTS_CHECK_HPP
@@ -0,0 +1,136 @@
+#include "check.hpp"
+
+#include <ecfcpp/ecfcpp.hpp>
+#include <ecfcpp/metaheuristics/ga/checkpoint.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using Chromosome = ecfcpp::Array< double, 10 >;
+
+constexpr std::size_t generations{ 30 };
+constexpr std::size_t every      { 10 };
+
+// Records best fitness of every generation and, given a writer, checkpoints
+// every few of them, waiting for each save so that none is skipped.
+class Recorder
+{
+public:
+    static constexpr bool timed{ false };
+
+    Recorder() noexcept = default;
+
+    explicit Recorder( ecfcpp::checkpoint::Writer & writer ) noexcept :
+        writer_    { &writer                                         },
+        checkpoint_{ ecfcpp::ga::observer::Checkpoint{ writer, every } }
+    {}
+
+    template< typename Population >
+    void operator()( ecfcpp::ga::Generation< Population > const & generation )
+    {
+        best.push_back( generation.fitness.best );
+
+        if ( checkpoint_ )
+        {
+            ( *checkpoint_ )( generation );
+            writer_->wait();
+        }
+    }
+
+    std::vector< double > best;
+
+private:
+    ecfcpp::checkpoint::Writer *                       writer_    { nullptr };
+    std::optional< ecfcpp::ga::observer::Checkpoint > checkpoint_;
+};
+
+// A run resumed from the last checkpoint of another goes through the same
+// generations and ends with the same best individual, even when the calling
+// thread drew other random numbers in between.
+template< typename Run >
+void resume( std::string const & path, Run const & run )
+{
+    ecfcpp::random::seed( 11 );
+    auto const initial
+    {
+        ecfcpp::factory::create( Chromosome{ -50, 50 }, 40, [](){ return ecfcpp::random::uniform( -50., 50. ); } )
+    };
+
+    std::filesystem::remove( path );
+
+    Recorder   saved;
+    auto const whole
+    {
+        [ & ]()
+        {
+            ecfcpp::checkpoint::Writer writer{ path };
+            Recorder                   recorder{ writer };
+
+            auto result{ run( generations, initial, recorder ) };
+            CHECK( writer.good() );
+            CHECK( writer.latest() == std::optional< std::uint64_t >{ generations - every } );
+
+            saved.best = recorder.best;
+            return result;
+        }()
+    };
+
+    ecfcpp::random::seed( 99 );
+
+    auto       population{ initial };
+    auto const generation{ ecfcpp::checkpoint::restore( path, population ) };
+    CHECK( generation == std::optional< std::uint64_t >{ generations - every } );
+
+    if ( generation )
+    {
+        Recorder   resumed;
+        auto const rest{ run( generations - *generation, population, resumed ) };
+
+        std::vector< double > const expected( std::next( std::begin( saved.best ), static_cast< std::ptrdiff_t >( *generation ) ), std::end( saved.best ) );
+        CHECK( resumed.best == expected );
+        CHECK( rest.fitness == whole.fitness );
+        CHECK( rest == whole );
+    }
+
+    std::filesystem::remove( path );
+}
+
+}
+
+int main()
+{
+    auto const path{ ( std::filesystem::temp_directory_path() / "ecfcpp_test_checkpoint" ).string() };
+
+    ecfcpp::problem::Minimization const problem  { ecfcpp::function::griewank< Chromosome > };
+    ecfcpp::selection::Tournament const selection{ 3                                        };
+    ecfcpp::crossover::BlxAlpha   const crossover{ 0.2f                                     };
+    ecfcpp::mutation ::Gaussian   const mutation { 0.1f, true, 0.3f                         };
+
+    resume
+    (
+        path,
+        [ & ]( std::size_t const maxGenerations, auto const & population, Recorder & recorder )
+        {
+            return ecfcpp::ga::generational( true, maxGenerations, -1, 0, problem, selection, crossover, mutation, population, recorder );
+        }
+    );
+
+    resume
+    (
+        path,
+        [ & ]( std::size_t const maxGenerations, auto const & population, Recorder & recorder )
+        {
+            return ecfcpp::ga::steady_state( 0.5f, maxGenerations, -1, 0, problem, selection, crossover, mutation, population, recorder );
+        }
+    );
+
+    return check::result();
+}
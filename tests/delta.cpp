@@ -0,0 +1,98 @@
+#include "check.hpp"
+
+#include <ecfcpp/ecfcpp.hpp>
+
+#include <cmath>
+#include <cstddef>
+
+namespace
+{
+
+constexpr std::size_t dimension     { 40  };
+constexpr std::size_t populationSize{ 30  };
+constexpr std::size_t generations   { 100 };
+
+using Chromosome = ecfcpp::Array< double, dimension >;
+
+// Delta of function after changing a few genes, recorded by a change log,
+// matches the difference of its full scores.
+template< typename Function >
+void matchesFullScores( Function const & function )
+{
+    ecfcpp::random::seed( 5 );
+    Chromosome point{ -5, 5 };
+    for ( auto & gene : point )
+    {
+        gene = ecfcpp::random::uniform( -5., 5. );
+    }
+    auto const before{ function( point ) };
+
+    ecfcpp::ChangeLog< double > log;
+    log.reset();
+    for ( std::size_t const index : { 3, 17, 3, 39 } )
+    {
+        log.write( point[ index ], index, ecfcpp::random::uniform( -5., 5. ) );
+    }
+
+    auto const delta{ function.delta( point, log.changes() ) };
+    CHECK( std::abs( before + delta - function( point ) ) <= 1e-9 * ( 1 + std::abs( before ) ) );
+}
+
+// Offspring start from a parent, so those which breeding changes in few genes
+// are scored from their changes. With single point crossover and rare
+// mutations that is most of them, and the score of the result still matches
+// its genes.
+template< typename Function, typename Run >
+void fewerFullEvaluations( Function const & scored, Run const & run )
+{
+    ecfcpp::function::CallCounter const function{ scored   };
+    ecfcpp::problem::Minimization const problem { function };
+
+    ecfcpp::random::seed( 3 );
+    auto const population
+    {
+        ecfcpp::factory::create( Chromosome{ -5, 5 }, populationSize, [](){ return ecfcpp::random::uniform( -5., 5. ); } )
+    };
+
+    auto const result{ run( problem, population ) };
+
+    CHECK( function.deltaCount() > function.callCount() );
+    CHECK( function.callCount() < populationSize * ( generations + 1 ) );
+    CHECK( std::abs( result.penalty - scored( result ) ) <= 1e-9 * ( 1 + std::abs( result.penalty ) ) );
+}
+
+}
+
+int main()
+{
+    ecfcpp::selection::Tournament   const selection{ 3                };
+    ecfcpp::crossover::SinglePoint  const crossover{                  };
+    ecfcpp::mutation ::Gaussian     const mutation { 0.01f, true, 0.3f };
+
+    matchesFullScores( ecfcpp::function::alpinen1 < Chromosome > );
+    matchesFullScores( ecfcpp::function::rastrigin< Chromosome > );
+    matchesFullScores( ecfcpp::function::sphere   < Chromosome > );
+
+    auto const generational
+    {
+        [ & ]( auto const & problem, auto const & population )
+        {
+            return ecfcpp::ga::generational( true, generations, 0, 0, problem, selection, crossover, mutation, population );
+        }
+    };
+
+    auto const steadyState
+    {
+        [ & ]( auto const & problem, auto const & population )
+        {
+            return ecfcpp::ga::steady_state( 0.5f, generations, 0, 0, problem, selection, crossover, mutation, population );
+        }
+    };
+
+    fewerFullEvaluations( ecfcpp::function::batch::sphere(),         generational );
+    fewerFullEvaluations( ecfcpp::function::batch::sphere(),         steadyState  );
+    fewerFullEvaluations( ecfcpp::function::rastrigin< Chromosome >, generational );
+    fewerFullEvaluations( ecfcpp::function::rastrigin< Chromosome >, steadyState  );
+
+    return check::result();
+}
@@ -0,0 +1,83 @@
+#include "check.hpp"
+
+#include <ecfcpp/functions/memoized.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+
+using Point = std::vector< double >;
+
+Point point( int const i ) { return { static_cast< double >( i ), 0.5 }; }
+
+// Cache never holds more genotypes than capacity, however it is sharded.
+void capacity()
+{
+    for ( std::size_t const capacity : { 1, 5, 10, 64 } )
+    {
+        for ( std::size_t const shardCount : { 1, 4, 16 } )
+        {
+            ecfcpp::function::Memoized const memoized{ []( Point const & x ){ return x[ 0 ]; }, capacity, shardCount };
+
+            for ( int i{ 0 }; i < 200; ++i )
+            {
+                CHECK( memoized( point( i ) ) == i );
+            }
+            CHECK( memoized.size() <= capacity );
+            CHECK( memoized.size() > 0 );
+        }
+    }
+}
+
+// With a single shard of 4, the hand passes over genotypes used since it last
+// did and evicts the first one which was not.
+void clockEviction()
+{
+    int calls{ 0 };
+    ecfcpp::function::Memoized const memoized{ [ & calls ]( Point const & x ){ ++calls; return x[ 0 ]; }, 4, 1 };
+
+    for ( int i{ 0 }; i < 4; ++i )
+    {
+        static_cast< void >( memoized( point( i ) ) );
+    }
+    CHECK( calls == 4 && memoized.size() == 4 );
+
+    // All four are referenced, so the hand clears them and evicts 0.
+    static_cast< void >( memoized( point( 4 ) ) );
+    CHECK( calls == 5 && memoized.size() == 4 );
+
+    // 1 is used again, so 5 evicts 2 instead.
+    CHECK( memoized( point( 1 ) ) == 1 );
+    CHECK( calls == 5 );
+    static_cast< void >( memoized( point( 5 ) ) );
+    CHECK( calls == 6 );
+
+    for ( int const cached : { 1, 3, 4, 5 } )
+    {
+        CHECK( memoized( point( cached ) ) == cached );
+    }
+    CHECK( calls == 6 );
+    CHECK( memoized.hitCount() == 5 && memoized.missCount() == 6 );
+
+    for ( int const evicted : { 0, 2 } )
+    {
+        auto const before{ calls };
+        CHECK( memoized( point( evicted ) ) == evicted );
+        CHECK( calls == before + 1 );
+    }
+
+    memoized.clear();
+    CHECK( memoized.size() == 0 );
+}
+
+}
+
+int main()
+{
+    capacity     ();
+    clockEviction();
+
+    return check::result();
+}
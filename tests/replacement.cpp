@@ -0,0 +1,56 @@
+#include "check.hpp"
+
+#include <ecfcpp/ecfcpp.hpp>
+
+#include <array>
+#include <cstddef>
+
+namespace
+{
+
+struct Individual
+{
+    double fitness;
+};
+
+// Every slot of a population, the last one included, can be replaced.
+template< typename Replacement >
+void everySlot( Replacement const & replacement )
+{
+    std::array< Individual, 4 > const population{ { { 0 }, { 0 }, { 0 }, { 0 } } };
+    Individual const offspring{ 1 };
+
+    std::array< std::size_t, 4 > counts{};
+    for ( int i{ 0 }; i < 10000; ++i )
+    {
+        auto const victim{ replacement( population, offspring ) };
+        CHECK( victim.has_value() && *victim < std::size( population ) );
+        if ( victim && *victim < std::size( population ) )
+        {
+            ++counts[ *victim ];
+        }
+    }
+
+    for ( auto const count : counts )
+    {
+        CHECK( count > 0 );
+    }
+}
+
+}
+
+int main()
+{
+    ecfcpp::random::seed( 3 );
+
+    everySlot( ecfcpp::ga::replacement::Random{} );
+    everySlot( ecfcpp::ga::replacement::Tournament{ 1 } );
+    everySlot( ecfcpp::ga::replacement::Tournament{ 3 } );
+
+    // The worst individual is the last one.
+    std::array< Individual, 4 > const population{ { { 3 }, { 2 }, { 1 }, { 0 } } };
+    CHECK( ecfcpp::ga::replacement::Worst{}( population, Individual{ 1 } ) == std::size_t{ 3 } );
+    CHECK( !ecfcpp::ga::replacement::Worst{}( population, Individual{ -1 } ) );
+
+    return check::result();
+}
@@ -0,0 +1,121 @@
+#include "check.hpp"
+
+#include <ecfcpp/utils/spsc_queue.hpp>
+
+#include <cstddef>
+#include <thread>
+
+namespace
+{
+
+using Queue = ecfcpp::parallel::SpscQueue< std::size_t >;
+
+void capacity()
+{
+    CHECK( Queue{ 1 }.capacity() == 1 );
+    CHECK( Queue{ 5 }.capacity() == 8 );
+    CHECK( Queue{ 8 }.capacity() == 8 );
+}
+
+// A full queue refuses pushes and an empty one pops, both leaving it as it
+// was.
+void fullAndEmpty()
+{
+    Queue       queue{ 4 };
+    std::size_t value{ 99 };
+
+    CHECK( !queue.pop( value ) && value == 99 );
+
+    for ( std::size_t i{ 0 }; i < 4; ++i )
+    {
+        CHECK( queue.push( i ) );
+    }
+    CHECK( !queue.push( 4 ) );
+
+    for ( std::size_t i{ 0 }; i < 4; ++i )
+    {
+        CHECK( queue.pop( value ) && value == i );
+    }
+    CHECK( !queue.pop( value ) && value == 3 );
+
+    CHECK( queue.push( 5 ) );
+    CHECK( queue.pop( value ) && value == 5 );
+}
+
+// Indices run far past the capacity, filling the queue at every offset of
+// the slots, without losing or reordering elements.
+void wrapAround()
+{
+    Queue       queue{ 4 };
+    std::size_t next { 0 };
+    std::size_t value{ 0 };
+    bool        ordered{ true };
+
+    for ( std::size_t round{ 0 }; round < 100; ++round )
+    {
+        auto const count{ 1 + round % 4 };
+        for ( std::size_t i{ 0 }; i < count; ++i )
+        {
+            CHECK( queue.push( next + i ) );
+        }
+        CHECK( count < 4 || !queue.push( 0 ) );
+
+        for ( std::size_t i{ 0 }; i < count; ++i )
+        {
+            ordered = ordered && queue.pop( value ) && value == next++;
+        }
+        CHECK( !queue.pop( value ) );
+    }
+    CHECK( ordered );
+}
+
+// A producer and a consumer on their own threads, with a queue small enough
+// to run full and empty often.
+void concurrent()
+{
+    constexpr std::size_t count{ 100000 };
+
+    Queue queue{ 4 };
+
+    std::thread producer
+    {
+        [ & queue ]()
+        {
+            for ( std::size_t i{ 0 }; i < count; ++i )
+            {
+                while ( !queue.push( i ) )
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    };
+
+    bool ordered{ true };
+    for ( std::size_t i{ 0 }; i < count; ++i )
+    {
+        std::size_t value;
+        while ( !queue.pop( value ) )
+        {
+            std::this_thread::yield();
+        }
+        ordered = ordered && value == i;
+    }
+    producer.join();
+
+    std::size_t value;
+    CHECK( ordered );
+    CHECK( !queue.pop( value ) );
+}
+
+}
+
+int main()
+{
+    capacity    ();
+    fullAndEmpty();
+    wrapAround  ();
+    concurrent  ();
+
+    return check::result();
+}
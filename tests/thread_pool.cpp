@@ -0,0 +1,88 @@
+#include "check.hpp"
+
+#include <ecfcpp/utils/thread_pool.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+
+// Every index of a loop is visited exactly once, whatever the chunk size.
+void everyIndexOnce( ecfcpp::parallel::ThreadPool & pool, std::size_t const count, std::size_t const chunkSize )
+{
+    auto const visits{ std::make_unique< std::atomic< int >[] >( count ) };
+
+    pool.forEach( count, chunkSize, [ & ]( std::size_t const i ){ visits[ i ].fetch_add( 1, std::memory_order_relaxed ); } );
+
+    bool once{ true };
+    for ( std::size_t i{ 0 }; i < count; ++i )
+    {
+        once = once && visits[ i ].load() == 1;
+    }
+    CHECK( once );
+}
+
+// The first exception thrown by a loop reaches the caller, and the pool keeps
+// working afterwards.
+void rethrows( ecfcpp::parallel::ThreadPool & pool )
+{
+    std::atomic< int > thrown{ 0 };
+    std::string        message;
+
+    try
+    {
+        pool.forEach
+        (
+            1000,
+            1,
+            [ & ]( std::size_t const i )
+            {
+                if ( i % 100 == 7 )
+                {
+                    thrown.fetch_add( 1 );
+                    throw std::runtime_error{ "index " + std::to_string( i ) };
+                }
+            }
+        );
+    }
+    catch ( std::runtime_error const & error )
+    {
+        message = error.what();
+    }
+
+    CHECK( thrown.load() > 0 );
+    CHECK( message.rfind( "index ", 0 ) == 0 );
+
+    everyIndexOnce( pool, 100, 0 );
+}
+
+}
+
+int main()
+{
+    ecfcpp::parallel::ThreadPool pool{ 4 };
+
+    everyIndexOnce( pool, 0,     0 );
+    everyIndexOnce( pool, 1,     0 );
+    everyIndexOnce( pool, 3,     7 );
+    everyIndexOnce( pool, 1000,  1 );
+    everyIndexOnce( pool, 10007, 0 );
+    everyIndexOnce( pool, 10007, 64 );
+
+    for ( int i{ 0 }; i < 100; ++i )
+    {
+        everyIndexOnce( pool, 257, 3 );
+    }
+
+    rethrows( pool );
+
+    ecfcpp::parallel::ThreadPool single{ 1 };
+    everyIndexOnce( single, 500, 0 );
+    rethrows( single );
+
+    return check::result();
+}
@@ -0,0 +1,97 @@
+#include "check.hpp"
+
+#include <ecfcpp/utils/trace.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+ecfcpp::trace::Record record( std::uint64_t const i )
+{
+    return { i, 1000 * i, -1.0 / static_cast< double >( i + 1 ), 0.25 * static_cast< double >( i ) };
+}
+
+// Records pushed to a binary writer are read back as they were, in order,
+// even when its queue is too small to hold them and the producer has to wait.
+void binary( std::string const & path )
+{
+    constexpr std::size_t count{ 1000 };
+
+    {
+        ecfcpp::trace::Writer writer{ path, ecfcpp::trace::Format::Binary, 4 };
+        CHECK( writer.good() );
+
+        for ( std::size_t i{ 0 }; i < count; ++i )
+        {
+            writer.push( record( i ) );
+        }
+    }
+
+    std::ifstream                        file{ path, std::ios::binary };
+    std::vector< ecfcpp::trace::Record > records;
+    CHECK( ecfcpp::trace::read( file, records ) );
+    CHECK( std::size( records ) == count );
+
+    bool same{ std::size( records ) == count };
+    for ( std::size_t i{ 0 }; same && i < count; ++i )
+    {
+        auto const expected{ record( i ) };
+        same = records[ i ].generation == expected.generation &&
+               records[ i ].elapsed    == expected.elapsed    &&
+               records[ i ].best       == expected.best       &&
+               records[ i ].diversity  == expected.diversity;
+    }
+    CHECK( same );
+}
+
+// CSV traces have a header line and a line for every record, and are not
+// mistaken for binary ones.
+void csv( std::string const & path )
+{
+    {
+        ecfcpp::trace::Writer writer{ path, ecfcpp::trace::Format::Csv };
+        for ( std::size_t i{ 0 }; i < 3; ++i )
+        {
+            writer.push( record( i ) );
+        }
+    }
+
+    std::ifstream              file{ path };
+    std::vector< std::string > lines;
+    for ( std::string line; std::getline( file, line ); )
+    {
+        lines.push_back( line );
+    }
+    CHECK( std::size( lines ) == 4 );
+    CHECK( !lines.empty() && lines[ 0 ] == "generation,elapsed_ns,best_fitness,diversity" );
+    CHECK( std::size( lines ) < 3 || lines[ 2 ] == "1,1000,-0.5,0.25" );
+
+    std::ifstream                        binary{ path, std::ios::binary };
+    std::vector< ecfcpp::trace::Record > records;
+    CHECK( !ecfcpp::trace::read( binary, records ) );
+    CHECK( records.empty() );
+}
+
+}
+
+int main()
+{
+    auto const directory{ std::filesystem::temp_directory_path() };
+    auto const binaryPath{ ( directory / "ecfcpp_test_trace.bin" ).string() };
+    auto const csvPath   { ( directory / "ecfcpp_test_trace.csv" ).string() };
+
+    binary( binaryPath );
+    csv   ( csvPath    );
+
+    std::filesystem::remove( binaryPath );
+    std::filesystem::remove( csvPath    );
+
+    return check::result();
+}
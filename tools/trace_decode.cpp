@@ -0,0 +1,40 @@
+#include <ecfcpp/utils/trace.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Prints a binary trace written by ecfcpp::trace::Writer as CSV.
+int main( int const argc, char const * const * const argv )
+{
+    if ( argc != 2 )
+    {
+        std::cerr << "Usage: ecfcpp_trace_decode TRACE\n";
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream file{ argv[ 1 ], std::ios::binary };
+    if ( !file )
+    {
+        std::cerr << "Cannot open " << argv[ 1 ] << ".\n";
+        return EXIT_FAILURE;
+    }
+
+    std::vector< ecfcpp::trace::Record > records;
+    if ( !ecfcpp::trace::read( file, records ) )
+    {
+        std::cerr << argv[ 1 ] << " is not a binary trace.\n";
+        return EXIT_FAILURE;
+    }
+
+    std::cout.precision( 17 );
+    ecfcpp::trace::writeCsvHeader( std::cout );
+    for ( auto const & record : records )
+    {
+        ecfcpp::trace::writeCsv( std::cout, record );
+    }
+
+    return EXIT_SUCCESS;
+}